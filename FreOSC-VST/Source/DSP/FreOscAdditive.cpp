@@ -0,0 +1,291 @@
+#include "FreOscAdditive.h"
+
+//==============================================================================
+FreOscAdditiveProfiles::FreOscAdditiveProfiles()
+{
+    // The audio thread can render before the first timer callback
+    publishedPartials = requestedPartials.load();
+    publishedBrightness = requestedBrightness.load();
+    buildSet(sets[frontIndex], publishedPartials, publishedBrightness);
+
+    startTimerHz(20);
+}
+
+FreOscAdditiveProfiles::~FreOscAdditiveProfiles()
+{
+    stopTimer();
+}
+
+//==============================================================================
+void FreOscAdditiveProfiles::requestProfiles(int numPartials, float brightness)
+{
+    requestedPartials.store(juce::jlimit(1, maxPartials, numPartials), std::memory_order_relaxed);
+    requestedBrightness.store(juce::jlimit(0.0f, 1.0f, brightness), std::memory_order_relaxed);
+}
+
+void FreOscAdditiveProfiles::acquireLatest()
+{
+    // Swap the front set with the middle one only when the timer has published a newer set
+    if ((middleIndex.load(std::memory_order_acquire) & newDataFlag) != 0)
+        frontIndex = middleIndex.exchange(frontIndex, std::memory_order_acq_rel) & ~newDataFlag;
+}
+
+const FreOscAdditiveProfiles::Profile& FreOscAdditiveProfiles::getProfile(int waveformIndex) const
+{
+    return sets[frontIndex].profiles[juce::jlimit(0, numProfiles - 1, waveformIndex)];
+}
+
+void FreOscAdditiveProfiles::timerCallback()
+{
+    const int numPartials = requestedPartials.load(std::memory_order_relaxed);
+    const float brightness = requestedBrightness.load(std::memory_order_relaxed);
+
+    if (numPartials == publishedPartials && brightness == publishedBrightness)
+        return;
+
+    // Build into the back set, then trade it for the middle one
+    buildSet(sets[backIndex], numPartials, brightness);
+    backIndex = middleIndex.exchange(backIndex | newDataFlag, std::memory_order_acq_rel) & ~newDataFlag;
+
+    publishedPartials = numPartials;
+    publishedBrightness = brightness;
+}
+
+//==============================================================================
+void FreOscAdditiveProfiles::buildSet(ProfileSet& set, int numPartials, float brightness)
+{
+    for (int waveformIndex = 0; waveformIndex < numProfiles; ++waveformIndex)
+        buildProfile(set.profiles[waveformIndex], waveformIndex, numPartials, brightness);
+}
+
+void FreOscAdditiveProfiles::buildProfile(Profile& profile, int waveformIndex, int numPartials, float brightness)
+{
+    using Constants = juce::MathConstants<double>;
+
+    numPartials = juce::jlimit(1, maxPartials, numPartials);
+
+    // Brightness tilts the spectrum by up to +/-6 dB per octave, at constant energy
+    const double tilt = (juce::jlimit(0.0f, 1.0f, brightness) - 0.5) * 2.0;
+    double plainEnergy = 0.0, tiltedEnergy = 0.0;
+    double amplitudes[maxPartials] = {};
+
+    for (int index = 0; index < numPartials; ++index)
+    {
+        const int harmonic = index + 1;
+        const bool odd = (harmonic % 2) == 1;
+        double amplitude = 0.0;
+
+        // Fourier series of the raw waveforms (sine phase)
+        switch (waveformIndex)
+        {
+            case 1: // Square
+                amplitude = odd ? 4.0 / (Constants::pi * harmonic) : 0.0;
+                break;
+
+            case 2: // Sawtooth, rising from -1
+                amplitude = -2.0 / (Constants::pi * harmonic);
+                break;
+
+            case 3: // Triangle, a quarter cycle ahead of the other render modes
+                amplitude = odd ? 8.0 / (Constants::pi * Constants::pi * harmonic * harmonic) * (((harmonic / 2) % 2) == 0 ? 1.0 : -1.0)
+                                : 0.0;
+                break;
+
+            case 0: // Sine
+            default:
+                amplitude = harmonic == 1 ? 1.0 : 0.0;
+                break;
+        }
+
+        plainEnergy += amplitude * amplitude;
+        amplitude *= std::pow(static_cast<double>(harmonic), tilt);
+        tiltedEnergy += amplitude * amplitude;
+        amplitudes[index] = amplitude;
+    }
+
+    const double scale = tiltedEnergy > 0.0 ? std::sqrt(plainEnergy / tiltedEnergy) : 1.0;
+
+    for (int index = 0; index < maxPartials; ++index)
+        profile.amplitudes[index] = static_cast<float>(amplitudes[index] * scale);
+
+    profile.numPartials = numPartials;
+}
+
+//==============================================================================
+FreOscAdditiveBank::FreOscAdditiveBank()
+{
+    reset();
+}
+
+void FreOscAdditiveBank::reset()
+{
+    for (int group = 0; group < maxGroups; ++group)
+    {
+        phasorRe[group] = Register::expand(1.0f);
+        phasorIm[group] = Register::expand(0.0f);
+    }
+
+    // Force a retune on the next render
+    tunedCyclesPerSample = -1.0;
+}
+
+void FreOscAdditiveBank::render(const FreOscAdditiveProfiles::Profile& profile, float* destination, int numSamples,
+                                double cyclesPerSample, const float* phaseModulation, float gain, bool addToDestination,
+                                FreOscFastMath::Precision precision)
+{
+    cyclesPerSample = std::abs(cyclesPerSample);
+    if (cyclesPerSample != tunedCyclesPerSample || profile.numPartials != tunedProfilePartials)
+        retune(cyclesPerSample, profile.numPartials);
+
+    for (int offset = 0; offset < numSamples; offset += blockSize)
+    {
+        const int chunkSamples = juce::jmin(blockSize, numSamples - offset);
+        renderChunk(profile, chunkSamples, phaseModulation != nullptr ? phaseModulation + offset : nullptr, precision);
+
+        auto* chunkDestination = destination + offset;
+        if (addToDestination)
+        {
+            for (int sample = 0; sample < chunkSamples; ++sample)
+                chunkDestination[sample] += sums[sample].sum() * gain;
+        }
+        else
+        {
+            for (int sample = 0; sample < chunkSamples; ++sample)
+                chunkDestination[sample] = sums[sample].sum() * gain;
+        }
+    }
+}
+
+//==============================================================================
+void FreOscAdditiveBank::retune(double cyclesPerSample, int profilePartials)
+{
+    tunedCyclesPerSample = cyclesPerSample;
+    tunedProfilePartials = profilePartials;
+
+    // Cull every partial at or above Nyquist
+    int audible = profilePartials;
+    if (cyclesPerSample > 0.0)
+        audible = juce::jmin(audible, static_cast<int>(std::ceil(0.5 / cyclesPerSample)) - 1);
+
+    numAudiblePartials = juce::jlimit(0, FreOscAdditiveProfiles::maxPartials, audible);
+
+    // Rotation of partial k is the fundamental's rotation to the power k -
+    // one sin/cos per retune, accumulated in double
+    const double angle = juce::MathConstants<double>::twoPi * cyclesPerSample;
+    const double stepRe = std::cos(angle), stepIm = std::sin(angle);
+    double re = stepRe, im = stepIm;
+
+    const int numGroups = (numAudiblePartials + numLanes - 1) / numLanes;
+    for (int group = 0; group < numGroups; ++group)
+    {
+        for (size_t lane = 0; lane < static_cast<size_t>(numLanes); ++lane)
+        {
+            rotationRe[group].set(lane, static_cast<float>(re));
+            rotationIm[group].set(lane, static_cast<float>(im));
+
+            const double nextRe = re * stepRe - im * stepIm;
+            im = re * stepIm + im * stepRe;
+            re = nextRe;
+        }
+    }
+}
+
+void FreOscAdditiveBank::renderChunk(const FreOscAdditiveProfiles::Profile& profile, int numSamples,
+                                     const float* phaseModulation, FreOscFastMath::Precision precision)
+{
+    const int numGroups = (numAudiblePartials + numLanes - 1) / numLanes;
+
+    for (int sample = 0; sample < numSamples; ++sample)
+        sums[sample] = Register::expand(0.0f);
+
+    // Phase modulation rotates partial k by k times the angle: lanes start at partials
+    // 1..numLanes and move on by numLanes times the angle per group
+    if (phaseModulation != nullptr)
+    {
+        for (int sample = 0; sample < numSamples; ++sample)
+        {
+            const float cosine = FreOscFastMath::cos(phaseModulation[sample], precision);
+            const float sine = FreOscFastMath::sin(phaseModulation[sample], precision);
+            float re = cosine, im = sine;
+
+            for (size_t lane = 0; lane < static_cast<size_t>(numLanes); ++lane)
+            {
+                modulationRe[sample].set(lane, re);
+                modulationIm[sample].set(lane, im);
+                modulationStepRe[sample] = re;
+                modulationStepIm[sample] = im;
+
+                const float nextRe = re * cosine - im * sine;
+                im = re * sine + im * cosine;
+                re = nextRe;
+            }
+        }
+    }
+
+    for (int group = 0; group < numGroups; ++group)
+    {
+        auto amplitude = Register::fromRawArray(profile.amplitudes + group * numLanes);
+
+        // Culled lanes of the last group stay silent
+        for (int lane = 0; lane < numLanes; ++lane)
+            if (group * numLanes + lane >= numAudiblePartials)
+                amplitude.set(static_cast<size_t>(lane), 0.0f);
+
+        auto re = phasorRe[group], im = phasorIm[group];
+        const auto stepRe = rotationRe[group], stepIm = rotationIm[group];
+
+        if (phaseModulation != nullptr)
+        {
+            for (int sample = 0; sample < numSamples; ++sample)
+            {
+                auto& modRe = modulationRe[sample];
+                auto& modIm = modulationIm[sample];
+
+                // Im(phasor * modulation)
+                sums[sample] += (im * modRe + re * modIm) * amplitude;
+
+                const auto nextRe = re * stepRe - im * stepIm;
+                im = re * stepIm + im * stepRe;
+                re = nextRe;
+
+                const auto modStepRe = Register::expand(modulationStepRe[sample]);
+                const auto modStepIm = Register::expand(modulationStepIm[sample]);
+                const auto nextModRe = modRe * modStepRe - modIm * modStepIm;
+                modIm = modRe * modStepIm + modIm * modStepRe;
+                modRe = nextModRe;
+            }
+        }
+        else
+        {
+            for (int sample = 0; sample < numSamples; ++sample)
+            {
+                sums[sample] += im * amplitude;
+
+                const auto nextRe = re * stepRe - im * stepIm;
+                im = re * stepIm + im * stepRe;
+                re = nextRe;
+            }
+        }
+
+        phasorRe[group] = re;
+        phasorIm[group] = im;
+    }
+
+    renormalise(numGroups);
+}
+
+void FreOscAdditiveBank::renormalise(int numGroups)
+{
+    // One Newton step towards magnitude 1 is plenty for the drift of one chunk
+    const auto threeHalves = Register::expand(1.5f);
+    const auto half = Register::expand(0.5f);
+
+    for (int group = 0; group < numGroups; ++group)
+    {
+        auto& re = phasorRe[group];
+        auto& im = phasorIm[group];
+        const auto correction = threeHalves - half * (re * re + im * im);
+        re = re * correction;
+        im = im * correction;
+    }
+}
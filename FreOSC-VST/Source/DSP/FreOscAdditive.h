@@ -0,0 +1,137 @@
+#pragma once
+
+#include <juce_events/juce_events.h>
+#include <juce_dsp/juce_dsp.h>
+#include <atomic>
+#include "FreOscFastMath.h"
+
+//==============================================================================
+/**
+    FreOSC Additive Profiles
+
+    Spectral profiles for the additive render mode: one per built-in
+    waveform, holding up to maxPartials harmonic amplitudes. The partial
+    count and the brightness tilt are shared by every additive oscillator
+    of a plugin instance.
+
+    Profiles are never built on the audio thread. The audio thread posts the
+    wanted settings (requestProfiles) and a message thread timer builds a
+    new set and publishes it through a lock-free triple buffer; the audio
+    thread picks it up with acquireLatest() at the start of a block and reads
+    that set until the next call.
+*/
+class FreOscAdditiveProfiles : private juce::Timer
+{
+public:
+    //==============================================================================
+    static constexpr int maxPartials = 256;
+    static constexpr int numProfiles = 4;   // Index matches FreOscOscillator::Waveform
+
+    struct Profile
+    {
+        alignas(64) float amplitudes[maxPartials] = {};    // Sine amplitude of harmonic index + 1
+        int numPartials = 0;
+    };
+
+    //==============================================================================
+    FreOscAdditiveProfiles();   // Builds the default set synchronously
+    ~FreOscAdditiveProfiles() override;
+
+    // Audio thread - no locks, no allocation. brightness 0-1, 0.5 = the plain waveform
+    void requestProfiles(int numPartials, float brightness);
+    void acquireLatest();
+
+    // Profile of the set acquired last (audio and voice render threads)
+    const Profile& getProfile(int waveformIndex) const;
+
+    static void buildProfile(Profile& profile, int waveformIndex, int numPartials, float brightness);
+
+private:
+    //==============================================================================
+    struct ProfileSet
+    {
+        Profile profiles[numProfiles];
+    };
+
+    static constexpr int newDataFlag = 4;   // Set on the middle index when it holds a newer set
+
+    ProfileSet sets[3];
+    int frontIndex = 0;                     // Read by the audio thread
+    int backIndex = 2;                      // Written by the timer
+    std::atomic<int> middleIndex { 1 };
+
+    std::atomic<int> requestedPartials { 64 };
+    std::atomic<float> requestedBrightness { 0.5f };
+
+    // Settings of the set published last (timer only)
+    int publishedPartials = 0;
+    float publishedBrightness = 0.0f;
+
+    void timerCallback() override;
+    static void buildSet(ProfileSet& set, int numPartials, float brightness);
+
+    //==============================================================================
+    JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR(FreOscAdditiveProfiles)
+};
+
+//==============================================================================
+/**
+    FreOSC Additive Bank
+
+    The partials of one additive oscillator as recursive rotating phasors,
+    SIMD lanes across partials. Every sample each phasor is multiplied by its
+    per-sample rotation, so no sine is evaluated per partial; the rotations
+    themselves are built once per retune as powers of the fundamental's.
+
+    Partials at or above Nyquist are culled whenever the bank is retuned,
+    so the cost follows the audible partial count. Phasor magnitudes are
+    renormalised after every block to stop rounding drift.
+*/
+class FreOscAdditiveBank
+{
+public:
+    //==============================================================================
+    using Register = juce::dsp::SIMDRegister<float>;
+
+    static constexpr int numLanes = static_cast<int>(Register::SIMDNumElements);
+    static constexpr int maxGroups = FreOscAdditiveProfiles::maxPartials / numLanes;
+
+    //==============================================================================
+    FreOscAdditiveBank();
+
+    // All partials back to sine phase zero
+    void reset();
+
+    // Renders gain * profile. cyclesPerSample is the fundamental's advance for this call
+    // (pitch modulation included), phaseModulation optional radians per sample.
+    void render(const FreOscAdditiveProfiles::Profile& profile, float* destination, int numSamples,
+                double cyclesPerSample, const float* phaseModulation, float gain, bool addToDestination,
+                FreOscFastMath::Precision precision);
+
+private:
+    //==============================================================================
+    static constexpr int blockSize = 64;
+
+    Register phasorRe[maxGroups], phasorIm[maxGroups];
+    Register rotationRe[maxGroups], rotationIm[maxGroups];
+
+    double tunedCyclesPerSample = -1.0;
+    int tunedProfilePartials = 0;
+    int numAudiblePartials = 0;
+
+    // Per-sample sums across partial groups for one chunk
+    Register sums[blockSize];
+
+    // Phase modulation rotations: lanes hold partials 1..numLanes, step is numLanes times the angle
+    Register modulationRe[blockSize], modulationIm[blockSize];
+    float modulationStepRe[blockSize] = {}, modulationStepIm[blockSize] = {};
+
+    //==============================================================================
+    void retune(double cyclesPerSample, int profilePartials);
+    void renderChunk(const FreOscAdditiveProfiles::Profile& profile, int numSamples, const float* phaseModulation,
+                     FreOscFastMath::Precision precision);
+    void renormalise(int numGroups);
+
+    //==============================================================================
+    JUCE_LEAK_DETECTOR(FreOscAdditiveBank)
+};
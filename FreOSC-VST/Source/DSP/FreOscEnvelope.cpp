@@ -90,6 +90,94 @@ float FreOscEnvelope::getNextSample()
     return juce::jmax(currentLevel, 0.001f);
 }
 
+float FreOscEnvelope::advance(int numSamples)
+{
+    if (numSamples <= 1)
+        return getNextSample();
+
+    if (currentPhase == Idle)
+        return 0.0f;
+
+    // Linear segments, so whole runs of samples can be skipped in closed form.
+    // Each case consumes the samples spent in its phase and moves on.
+    while (numSamples > 0 && currentPhase != Idle)
+    {
+        switch (currentPhase)
+        {
+            case Attack:
+            {
+                int samplesToPeak = static_cast<int>(std::ceil((1.0f - currentLevel) / attackRate));
+                if (samplesToPeak > numSamples)
+                {
+                    currentLevel += attackRate * static_cast<float>(numSamples);
+                    numSamples = 0;
+                }
+                else
+                {
+                    currentLevel = 1.0f;
+                    numSamples -= juce::jmax(1, samplesToPeak);
+                    setPhase(Decay);
+                }
+                break;
+            }
+                
+            case Decay:
+            {
+                // A zero decay rate never reaches sustain (matches getNextSample)
+                if (decayRate <= 0.0f && currentLevel > parameters.sustain)
+                {
+                    numSamples = 0;
+                    break;
+                }
+
+                int samplesToSustain = decayRate > 0.0f ? static_cast<int>(std::ceil((currentLevel - parameters.sustain) / decayRate)) : 0;
+                if (samplesToSustain > numSamples)
+                {
+                    currentLevel -= decayRate * static_cast<float>(numSamples);
+                    numSamples = 0;
+                }
+                else
+                {
+                    currentLevel = parameters.sustain;
+                    numSamples -= juce::jmax(1, samplesToSustain);
+                    setPhase(Sustain);
+                }
+                break;
+            }
+                
+            case Sustain:
+                currentLevel = parameters.sustain;
+                numSamples = 0;
+                break;
+                
+            case Release:
+            {
+                int samplesToIdle = static_cast<int>(std::ceil(currentLevel / releaseRate));
+                if (samplesToIdle > numSamples)
+                {
+                    currentLevel -= releaseRate * static_cast<float>(numSamples);
+                    numSamples = 0;
+                }
+                else
+                {
+                    currentLevel = 0.0f;
+                    numSamples = 0;
+                    setPhase(Idle);
+                }
+                break;
+            }
+
+            case Idle:
+            default:
+                numSamples = 0;
+                break;
+        }
+    }
+    
+    // Apply minimum level to prevent pops (same as getNextSample)
+    return juce::jmax(currentLevel, 0.001f);
+}
+
 bool FreOscEnvelope::isActive() const
 {
     return currentPhase != Idle;
@@ -100,17 +188,29 @@ void FreOscEnvelope::calculateRates()
 {
     if (sampleRate <= 0.0)
         return;
-        
+
+    auto rates = calculateRates(parameters, sampleRate);
+    attackRate = rates.attack;
+    decayRate = rates.decay;
+    releaseRate = rates.release;
+}
+
+FreOscEnvelope::Rates FreOscEnvelope::calculateRates(const Parameters& params, double sampleRate)
+{
+    Rates rates;
+
     // Calculate rates as level change per sample
     // Attack: 0 to 1 over attack time
-    attackRate = (parameters.attack > 0.0f) ? (1.0f / (parameters.attack * static_cast<float>(sampleRate))) : 1.0f;
+    rates.attack = (params.attack > 0.0f) ? (1.0f / (params.attack * static_cast<float>(sampleRate))) : 1.0f;
     
     // Decay: 1 to sustain over decay time
-    float decayRange = 1.0f - parameters.sustain;
-    decayRate = (parameters.decay > 0.0f && decayRange > 0.0f) ? (decayRange / (parameters.decay * static_cast<float>(sampleRate))) : 0.0f;
+    float decayRange = 1.0f - params.sustain;
+    rates.decay = (params.decay > 0.0f && decayRange > 0.0f) ? (decayRange / (params.decay * static_cast<float>(sampleRate))) : 0.0f;
     
     // Release: current level to 0 over release time
-    releaseRate = (parameters.release > 0.0f) ? (1.0f / (parameters.release * static_cast<float>(sampleRate))) : 1.0f;
+    rates.release = (params.release > 0.0f) ? (1.0f / (params.release * static_cast<float>(sampleRate))) : 1.0f;
+
+    return rates;
 }
 
 void FreOscEnvelope::setPhase(Phase newPhase)
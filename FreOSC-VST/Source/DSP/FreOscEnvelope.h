@@ -29,6 +29,16 @@ public:
         float sustain = 0.6f;  // level (0-1)
         float release = 0.5f;  // seconds
     };
+
+    // Level change per sample for each linear segment
+    struct Rates
+    {
+        float attack = 0.0f;
+        float decay = 0.0f;
+        float release = 0.0f;
+    };
+
+    static Rates calculateRates(const Parameters& params, double sampleRate);
     
     //==============================================================================
     FreOscEnvelope();
@@ -45,8 +55,10 @@ public:
     
     //==============================================================================
     float getNextSample();
+    float advance(int numSamples); // Skip ahead numSamples, returns the level reached (for control-rate use)
     bool isActive() const;
     Phase getCurrentPhase() const { return currentPhase; }
+    float getCurrentLevel() const { return currentLevel; }
     
 private:
     //==============================================================================
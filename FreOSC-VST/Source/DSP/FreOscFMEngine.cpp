@@ -0,0 +1,358 @@
+#include "FreOscFMEngine.h"
+#include <type_traits>
+#include <utility>
+
+namespace
+{
+    constexpr int numOperators = FreOscFMEngine::numOperators;
+
+    // Operator numbers (1-6) to a bit mask
+    template <typename... Numbers>
+    constexpr juce::uint32 ops(Numbers... numbers)
+    {
+        return ((1u << (numbers - 1)) | ... | 0u);
+    }
+
+    constexpr int countOperators(juce::uint32 mask)
+    {
+        int count = 0;
+        for (; mask != 0; mask &= mask - 1)
+            ++count;
+        return count;
+    }
+
+    //==============================================================================
+    // Algorithm graphs. modulators[i] is the mask of operators feeding operator i + 1,
+    // carriers the mask of operators summed into the output.
+    template <int algorithm>
+    struct AlgorithmGraph;
+
+    template <>
+    struct AlgorithmGraph<FreOscFMEngine::Stack>
+    {
+        static constexpr juce::uint32 modulators[numOperators] = { ops(2), ops(3), ops(4), ops(5), ops(6), 0 };
+        static constexpr juce::uint32 carriers = ops(1);
+        static constexpr int feedbackOperator = 6;
+    };
+
+    template <>
+    struct AlgorithmGraph<FreOscFMEngine::StackAndPair>
+    {
+        static constexpr juce::uint32 modulators[numOperators] = { ops(2), 0, ops(4), ops(5), ops(6), 0 };
+        static constexpr juce::uint32 carriers = ops(1, 3);
+        static constexpr int feedbackOperator = 6;
+    };
+
+    template <>
+    struct AlgorithmGraph<FreOscFMEngine::TwoStacks>
+    {
+        static constexpr juce::uint32 modulators[numOperators] = { ops(2), ops(3), 0, ops(5), ops(6), 0 };
+        static constexpr juce::uint32 carriers = ops(1, 4);
+        static constexpr int feedbackOperator = 6;
+    };
+
+    template <>
+    struct AlgorithmGraph<FreOscFMEngine::Branch>
+    {
+        static constexpr juce::uint32 modulators[numOperators] = { ops(2), 0, ops(4, 5), 0, ops(6), 0 };
+        static constexpr juce::uint32 carriers = ops(1, 3);
+        static constexpr int feedbackOperator = 6;
+    };
+
+    template <>
+    struct AlgorithmGraph<FreOscFMEngine::ThreePairs>
+    {
+        static constexpr juce::uint32 modulators[numOperators] = { ops(2), 0, ops(4), 0, ops(6), 0 };
+        static constexpr juce::uint32 carriers = ops(1, 3, 5);
+        static constexpr int feedbackOperator = 6;
+    };
+
+    template <>
+    struct AlgorithmGraph<FreOscFMEngine::PairAndFan>
+    {
+        static constexpr juce::uint32 modulators[numOperators] = { ops(2), 0, ops(6), ops(6), ops(6), 0 };
+        static constexpr juce::uint32 carriers = ops(1, 3, 4, 5);
+        static constexpr int feedbackOperator = 6;
+    };
+
+    template <>
+    struct AlgorithmGraph<FreOscFMEngine::Fan>
+    {
+        static constexpr juce::uint32 modulators[numOperators] = { ops(6), ops(6), ops(6), ops(6), ops(6), 0 };
+        static constexpr juce::uint32 carriers = ops(1, 2, 3, 4, 5);
+        static constexpr int feedbackOperator = 6;
+    };
+
+    template <>
+    struct AlgorithmGraph<FreOscFMEngine::Additive>
+    {
+        static constexpr juce::uint32 modulators[numOperators] = { 0, 0, 0, 0, 0, 0 };
+        static constexpr juce::uint32 carriers = ops(1, 2, 3, 4, 5, 6);
+        static constexpr int feedbackOperator = 6;
+    };
+
+    // Operators are evaluated from 6 down to 1, so a modulator must have a higher number
+    template <typename Graph>
+    constexpr bool isFeedForward()
+    {
+        for (int op = 0; op < numOperators; ++op)
+            if ((Graph::modulators[op] & ((2u << op) - 1u)) != 0)
+                return false;
+
+        return Graph::carriers != 0;
+    }
+
+    //==============================================================================
+    // Modulation in operator output units -> phase (1.0 = 4 pi radians = 2 cycles)
+    constexpr float modulationPhaseScale = 2.0f * 4294967296.0f;
+
+    // Feedback at full amount: pi radians for the mean of the last two outputs
+    constexpr float feedbackPhaseScale = 0.5f * 4294967296.0f;
+
+    template <juce::uint32 mask, size_t source>
+    inline float selectOutput(const float* outputs) noexcept
+    {
+        if constexpr (((mask >> source) & 1u) != 0)
+            return outputs[source];
+        else
+            return 0.0f;
+    }
+
+    template <juce::uint32 mask, size_t... sources>
+    inline float sumOutputs(const float* outputs, std::index_sequence<sources...>) noexcept
+    {
+        return (selectOutput<mask, sources>(outputs) + ...);
+    }
+
+    template <juce::uint32 mask>
+    inline float sumOutputs(const float* outputs) noexcept
+    {
+        return sumOutputs<mask>(outputs, std::make_index_sequence<numOperators>());
+    }
+
+    // One operator, then the next lower one - unrolled at compile time
+    template <typename Graph, FreOscFastMath::Precision precision, int op>
+    inline void evaluateOperators(const FreOscFastMath::Phase* phases, const float* amplitudes,
+                                  float feedbackPhase, float* outputs) noexcept
+    {
+        constexpr juce::uint32 mask = Graph::modulators[op];
+
+        float offset = 0.0f;
+        if constexpr (mask != 0)
+            offset = sumOutputs<mask>(outputs) * modulationPhaseScale;
+        if constexpr (op == Graph::feedbackOperator - 1)
+            offset += feedbackPhase;
+
+        // Through int64 so large indices wrap modulo one cycle
+        const auto phase = phases[op] + static_cast<FreOscFastMath::Phase>(static_cast<juce::int64>(offset));
+        outputs[op] = FreOscFastMath::sinPhase(phase, precision) * amplitudes[op];
+
+        if constexpr (op > 0)
+            evaluateOperators<Graph, precision, op - 1>(phases, amplitudes, feedbackPhase, outputs);
+    }
+}
+
+//==============================================================================
+FreOscFMEngine::FreOscFMEngine()
+{
+    updateRenderFunction();
+}
+
+void FreOscFMEngine::prepare(double sampleRate)
+{
+    currentSampleRate = sampleRate;
+
+    for (auto& op : operators)
+        op.envelope.setSampleRate(sampleRate);
+
+    updateIncrements();
+    reset();
+}
+
+void FreOscFMEngine::reset()
+{
+    for (auto& op : operators)
+    {
+        op.phase = 0;
+        op.envelope.reset();
+    }
+
+    feedbackHistory[0] = feedbackHistory[1] = 0.0f;
+}
+
+//==============================================================================
+void FreOscFMEngine::setAlgorithm(int newAlgorithm)
+{
+    newAlgorithm = juce::jlimit(0, NumAlgorithms - 1, newAlgorithm);
+    if (newAlgorithm == algorithm)
+        return;
+
+    algorithm = newAlgorithm;
+    updateRenderFunction();
+}
+
+void FreOscFMEngine::setFeedback(float amount)
+{
+    feedback = juce::jlimit(0.0f, 1.0f, amount);
+}
+
+void FreOscFMEngine::setOperator(int index, const OperatorSettings& settings)
+{
+    jassert(juce::isPositiveAndBelow(index, numOperators));
+
+    auto& op = operators[index];
+    op.level = juce::jmax(0.0f, settings.level);
+    op.envelope.setParameters(settings.envelope);
+
+    if (settings.ratio != op.ratio)
+    {
+        op.ratio = settings.ratio;
+        op.phaseIncrement = FreOscFastMath::phaseIncrementForFrequency(noteFrequency * op.ratio, currentSampleRate);
+    }
+}
+
+void FreOscFMEngine::setTrigPrecision(FreOscFastMath::Precision precision)
+{
+    if (precision == trigPrecision)
+        return;
+
+    trigPrecision = precision;
+    updateRenderFunction();
+}
+
+void FreOscFMEngine::setNoteFrequency(float frequency)
+{
+    if (frequency == noteFrequency)
+        return;
+
+    noteFrequency = frequency;
+    updateIncrements();
+}
+
+void FreOscFMEngine::noteOn()
+{
+    // Operators start in phase so every note has the same attack transient
+    for (auto& op : operators)
+    {
+        op.phase = 0;
+        op.envelope.noteOn();
+    }
+
+    feedbackHistory[0] = feedbackHistory[1] = 0.0f;
+}
+
+void FreOscFMEngine::noteOff()
+{
+    for (auto& op : operators)
+        op.envelope.noteOff();
+}
+
+//==============================================================================
+void FreOscFMEngine::renderBlock(float* destination, int numSamples, float gain, const float* pitchModulation)
+{
+    for (int offset = 0; offset < numSamples; offset += blockSize)
+    {
+        const int blockSamples = juce::jmin(blockSize, numSamples - offset);
+
+        // Envelopes first, so the graph loop only reads amplitudes
+        for (int index = 0; index < numOperators; ++index)
+        {
+            auto& op = operators[index];
+            for (int sample = 0; sample < blockSamples; ++sample)
+                amplitudes[sample][index] = op.envelope.getNextSample() * op.level;
+        }
+
+        if (pitchModulation != nullptr)
+        {
+            for (int sample = 0; sample < blockSamples; ++sample)
+                pitchRatios[sample] = 1.0f + pitchModulation[offset + sample];
+        }
+        else
+        {
+            juce::FloatVectorOperations::fill(pitchRatios, 1.0f, blockSamples);
+        }
+
+        (this->*renderFunction)(destination + offset, blockSamples, gain, pitchRatios);
+    }
+}
+
+template <typename Graph, FreOscFastMath::Precision precision>
+void FreOscFMEngine::renderGraph(float* destination, int numSamples, float gain, const float* pitchRatio)
+{
+    static_assert(isFeedForward<Graph>(), "FM algorithm graph must only modulate lower-numbered operators");
+
+    constexpr float outputScale = 1.0f / static_cast<float>(countOperators(Graph::carriers));
+    constexpr int feedbackIndex = Graph::feedbackOperator - 1;
+
+    // Local copies so the accumulators stay in registers
+    Phase phases[numOperators], increments[numOperators];
+    for (int index = 0; index < numOperators; ++index)
+    {
+        phases[index] = operators[index].phase;
+        increments[index] = operators[index].phaseIncrement;
+    }
+
+    float history0 = feedbackHistory[0], history1 = feedbackHistory[1];
+    const float feedbackScale = feedback * feedbackPhaseScale * 0.5f;
+    const float outputGain = gain * outputScale;
+
+    for (int sample = 0; sample < numSamples; ++sample)
+    {
+        float outputs[numOperators];
+        evaluateOperators<Graph, precision, numOperators - 1>(phases, amplitudes[sample],
+                                                              (history0 + history1) * feedbackScale, outputs);
+
+        history1 = history0;
+        history0 = outputs[feedbackIndex];
+
+        destination[sample] += sumOutputs<Graph::carriers>(outputs) * outputGain;
+
+        for (int index = 0; index < numOperators; ++index)
+            phases[index] += FreOscFastMath::scalePhaseIncrement(increments[index], pitchRatio[sample]);
+    }
+
+    for (int index = 0; index < numOperators; ++index)
+        operators[index].phase = phases[index];
+
+    feedbackHistory[0] = history0;
+    feedbackHistory[1] = history1;
+}
+
+//==============================================================================
+void FreOscFMEngine::updateIncrements()
+{
+    for (auto& op : operators)
+        op.phaseIncrement = FreOscFastMath::phaseIncrementForFrequency(noteFrequency * op.ratio, currentSampleRate);
+}
+
+void FreOscFMEngine::updateRenderFunction()
+{
+    // One instantiation per algorithm and precision - the graph is fixed inside each
+    auto select = [this](auto precisionConstant) -> RenderFunction
+    {
+        constexpr auto precision = decltype(precisionConstant)::value;
+
+        switch (algorithm)
+        {
+            case StackAndPair:  return &FreOscFMEngine::renderGraph<AlgorithmGraph<StackAndPair>, precision>;
+            case TwoStacks:     return &FreOscFMEngine::renderGraph<AlgorithmGraph<TwoStacks>, precision>;
+            case Branch:        return &FreOscFMEngine::renderGraph<AlgorithmGraph<Branch>, precision>;
+            case ThreePairs:    return &FreOscFMEngine::renderGraph<AlgorithmGraph<ThreePairs>, precision>;
+            case PairAndFan:    return &FreOscFMEngine::renderGraph<AlgorithmGraph<PairAndFan>, precision>;
+            case Fan:           return &FreOscFMEngine::renderGraph<AlgorithmGraph<Fan>, precision>;
+            case Additive:      return &FreOscFMEngine::renderGraph<AlgorithmGraph<Additive>, precision>;
+            case Stack:
+            default:            return &FreOscFMEngine::renderGraph<AlgorithmGraph<Stack>, precision>;
+        }
+    };
+
+    using Precision = FreOscFastMath::Precision;
+
+    switch (trigPrecision)
+    {
+        case Precision::Exact:  renderFunction = select(std::integral_constant<Precision, Precision::Exact>()); break;
+        case Precision::Table:  renderFunction = select(std::integral_constant<Precision, Precision::Table>()); break;
+        case Precision::Polynomial:
+        default:                renderFunction = select(std::integral_constant<Precision, Precision::Polynomial>()); break;
+    }
+}
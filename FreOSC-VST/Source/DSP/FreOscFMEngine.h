@@ -0,0 +1,113 @@
+#pragma once
+
+#include <juce_core/juce_core.h>
+#include "FreOscEnvelope.h"
+#include "FreOscFastMath.h"
+
+//==============================================================================
+/**
+    FreOSC FM Engine
+
+    Six sine operators connected by DX-style algorithm graphs (stacks,
+    parallel pairs, one modulator driving several carriers, all parallel).
+    Each operator has its own frequency ratio, level and envelope; one
+    operator per algorithm feeds back into itself.
+
+    Every algorithm is a compile-time graph (see FreOscFMEngine.cpp). The
+    render loop is instantiated once per algorithm and trig precision with
+    the operator order and modulation sums unrolled, so nothing is routed
+    per sample. Operators run from 6 down to 1: a modulator always has a
+    higher number than the operators it drives.
+
+    Level is the output amplitude of a carrier and the modulation index of
+    a modulator (1.0 = 4 pi radians).
+*/
+class FreOscFMEngine
+{
+public:
+    //==============================================================================
+    static constexpr int numOperators = 6;
+
+    // Operator graphs - "a>b" means a modulates b
+    enum Algorithm
+    {
+        Stack = 0,          // 6>5>4>3>2>1
+        StackAndPair,       // 2>1, 6>5>4>3
+        TwoStacks,          // 3>2>1, 6>5>4
+        Branch,             // 2>1, 4>3, 6>5>3
+        ThreePairs,         // 2>1, 4>3, 6>5
+        PairAndFan,         // 2>1, 6>3, 6>4, 6>5
+        Fan,                // 6>1 ... 6>5
+        Additive,           // All carriers
+        NumAlgorithms
+    };
+
+    struct OperatorSettings
+    {
+        float ratio = 1.0f;
+        float level = 0.0f;
+        FreOscEnvelope::Parameters envelope;
+    };
+
+    //==============================================================================
+    FreOscFMEngine();
+
+    void prepare(double sampleRate);
+    void reset();
+
+    //==============================================================================
+    void setAlgorithm(int newAlgorithm);
+    void setFeedback(float amount);                     // 0-1, up to pi radians
+    void setOperator(int index, const OperatorSettings& settings);
+    void setTrigPrecision(FreOscFastMath::Precision precision);
+    void setNoteFrequency(float frequency);
+
+    void noteOn();
+    void noteOff();
+
+    //==============================================================================
+    // Adds gain * output to destination. pitchModulation is the per-sample
+    // fraction of the fundamental (as for FreOscOscillator), or nullptr.
+    void renderBlock(float* destination, int numSamples, float gain, const float* pitchModulation = nullptr);
+
+private:
+    //==============================================================================
+    using Phase = FreOscFastMath::Phase;
+    using RenderFunction = void (FreOscFMEngine::*)(float*, int, float, const float*);
+
+    static constexpr int blockSize = 64;
+
+    struct Operator
+    {
+        Phase phase = 0;
+        Phase phaseIncrement = 0;
+        float ratio = 1.0f;
+        float level = 0.0f;
+        FreOscEnvelope envelope;
+    };
+
+    Operator operators[numOperators];
+
+    double currentSampleRate = 44100.0;
+    float noteFrequency = 440.0f;
+    float feedback = 0.0f;
+    float feedbackHistory[2] = {};  // Last two outputs of the feedback operator
+
+    int algorithm = Stack;
+    FreOscFastMath::Precision trigPrecision = FreOscFastMath::Precision::Polynomial;
+    RenderFunction renderFunction = nullptr;
+
+    // Per-sample operator amplitudes (level * envelope) and pitch ratios for one block
+    float amplitudes[blockSize][numOperators] = {};
+    float pitchRatios[blockSize] = {};
+
+    //==============================================================================
+    void updateIncrements();
+    void updateRenderFunction();
+
+    template <typename Graph, FreOscFastMath::Precision precision>
+    void renderGraph(float* destination, int numSamples, float gain, const float* pitchRatio);
+
+    //==============================================================================
+    JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR(FreOscFMEngine)
+};
@@ -0,0 +1,81 @@
+#include "FreOscFastMath.h"
+
+//==============================================================================
+namespace
+{
+    struct SineTable
+    {
+        SineTable()
+        {
+            for (int i = 0; i <= size; ++i)
+                values[i] = static_cast<float>(std::sin(juce::MathConstants<double>::twoPi * i / size));
+        }
+
+        static constexpr int size = 4096;
+        float values[size + 1];
+    };
+
+    // Built during static initialisation, never on the audio thread
+    const SineTable sineTable;
+}
+
+const float* FreOscFastMath::getSineTable() noexcept
+{
+    static_assert(SineTable::size == tableSize, "Sine table size out of sync");
+    static_assert((1 << tableBits) == tableSize, "sinPhase() indexes the table with the top phase bits");
+    return sineTable.values;
+}
+
+//==============================================================================
+void FreOscFastMath::sinBlock(const float* radians, float* sines, int numSamples, Precision precision) noexcept
+{
+    switch (precision)
+    {
+        case Precision::Polynomial:
+            for (int i = 0; i < numSamples; ++i)
+                sines[i] = sinPolynomial(radians[i]);
+            break;
+
+        case Precision::Table:
+            for (int i = 0; i < numSamples; ++i)
+                sines[i] = sinTable(radians[i]);
+            break;
+
+        case Precision::Exact:
+        default:
+            for (int i = 0; i < numSamples; ++i)
+                sines[i] = std::sin(radians[i]);
+            break;
+    }
+}
+
+void FreOscFastMath::sinCosBlock(const float* radians, float* sines, float* cosines, int numSamples, Precision precision) noexcept
+{
+    switch (precision)
+    {
+        case Precision::Polynomial:
+            for (int i = 0; i < numSamples; ++i)
+            {
+                sines[i] = sinPolynomial(radians[i]);
+                cosines[i] = sinPolynomial(radians[i] + juce::MathConstants<float>::halfPi);
+            }
+            break;
+
+        case Precision::Table:
+            for (int i = 0; i < numSamples; ++i)
+            {
+                sines[i] = sinTable(radians[i]);
+                cosines[i] = sinTable(radians[i] + juce::MathConstants<float>::halfPi);
+            }
+            break;
+
+        case Precision::Exact:
+        default:
+            for (int i = 0; i < numSamples; ++i)
+            {
+                sines[i] = std::sin(radians[i]);
+                cosines[i] = std::cos(radians[i]);
+            }
+            break;
+    }
+}
@@ -0,0 +1,205 @@
+#pragma once
+
+#include <juce_core/juce_core.h>
+#include <cmath>
+
+//==============================================================================
+/**
+    FreOSC Fast Math
+
+    Sine/cosine kernels shared by the oscillators, LFOs and the pan law.
+
+    - Exact:      std::sin / std::cos
+    - Polynomial: range reduction to [-pi/2, pi/2] and a degree 9 minimax
+                  polynomial (3.3e-9 in double). Max absolute error 7e-7
+                  for |x| < 2pi; beyond that the float range reduction adds
+                  roughly 1e-7 * |x|.
+    - Table:      4096 point sine table with linear interpolation.
+                  Max absolute error 5e-7 for |x| < 2pi, same growth.
+
+    The block versions are written without branches so the compiler can
+    vectorise them.
+
+    Oscillator phases are normalised 32-bit accumulators: the full uint32
+    range is one cycle, so the phase advance wraps by integer overflow and
+    never drifts. sinPhase() evaluates one directly, without range
+    reduction, so its error does not grow with the argument (2e-7
+    polynomial, 4e-7 table).
+*/
+class FreOscFastMath
+{
+public:
+    //==============================================================================
+    enum class Precision
+    {
+        Exact = 0,
+        Polynomial,
+        Table
+    };
+
+    //==============================================================================
+    // Normalised phase: 2^32 steps per cycle
+    using Phase = juce::uint32;
+
+    static Phase phaseIncrementForFrequency(double frequency, double sampleRate) noexcept;
+    static Phase phaseFromRadians(float radians) noexcept;     // Any sign and magnitude, wrapped
+    static Phase scalePhaseIncrement(Phase increment, float ratio) noexcept; // Negative ratios run backwards
+    static float phaseToRadians(Phase phase) noexcept;         // [0, 2*pi)
+    static float phaseToCycles(Phase phase) noexcept;          // [0, 1)
+    static float phaseDeltaToCycles(Phase delta) noexcept;     // Signed, [-0.5, 0.5)
+
+    //==============================================================================
+    static float sin(float radians, Precision precision) noexcept;
+    static float cos(float radians, Precision precision) noexcept;
+
+    static float sinPhase(Phase phase, Precision precision) noexcept;
+
+    static float sinPolynomial(float radians) noexcept;
+    static float sinTable(float radians) noexcept;
+
+    //==============================================================================
+    // Block versions
+    static void sinBlock(const float* radians, float* sines, int numSamples, Precision precision) noexcept;
+    static void sinCosBlock(const float* radians, float* sines, float* cosines, int numSamples, Precision precision) noexcept;
+
+private:
+    //==============================================================================
+    static constexpr int tableSize = 4096;
+    static constexpr int tableBits = 12;
+    static constexpr double phaseRange = 4294967296.0; // 2^32
+
+    static float sinPolynomialCycles(float cycles) noexcept; // cycles in [-0.5, 0.5]
+    static const float* getSineTable() noexcept;   // tableSize + 1 values, built at static initialisation
+
+    FreOscFastMath() = delete;
+};
+
+//==============================================================================
+// Inline kernel implementations
+
+inline FreOscFastMath::Phase FreOscFastMath::phaseIncrementForFrequency(double frequency, double sampleRate) noexcept
+{
+    if (sampleRate <= 0.0)
+        return 0;
+
+    // Wrap in double first so negative or above-Nyquist frequencies stay well defined. A tiny
+    // negative value rounds the fraction up to exactly 1.0, so convert through int64, where
+    // 2^32 is in range and wraps to 0 like any other whole cycle
+    const double cycles = frequency / sampleRate;
+    return static_cast<Phase>(static_cast<juce::int64>((cycles - std::floor(cycles)) * phaseRange));
+}
+
+inline FreOscFastMath::Phase FreOscFastMath::phaseFromRadians(float radians) noexcept
+{
+    // Through int64 so negative offsets wrap modulo 2^32
+    constexpr double phasePerRadian = phaseRange / juce::MathConstants<double>::twoPi;
+    return static_cast<Phase>(static_cast<juce::int64>(static_cast<double>(radians) * phasePerRadian));
+}
+
+inline FreOscFastMath::Phase FreOscFastMath::scalePhaseIncrement(Phase increment, float ratio) noexcept
+{
+    return static_cast<Phase>(static_cast<juce::int64>(static_cast<double>(increment) * static_cast<double>(ratio)));
+}
+
+inline float FreOscFastMath::phaseToRadians(Phase phase) noexcept
+{
+    // Top 24 bits are exact in a float, so the result never rounds up to 2*pi
+    constexpr float radiansPerStep = juce::MathConstants<float>::twoPi / 16777216.0f;
+    return static_cast<float>(phase >> 8) * radiansPerStep;
+}
+
+inline float FreOscFastMath::phaseToCycles(Phase phase) noexcept
+{
+    return static_cast<float>(phase >> 8) * (1.0f / 16777216.0f);
+}
+
+inline float FreOscFastMath::phaseDeltaToCycles(Phase delta) noexcept
+{
+    return static_cast<float>(static_cast<juce::int32>(delta)) * static_cast<float>(1.0 / phaseRange);
+}
+
+//==============================================================================
+inline float FreOscFastMath::sinPolynomialCycles(float u) noexcept
+{
+    // Fold to [-0.25, 0.25] cycles using sin(pi - x) = sin(x)
+    const float folded = std::copysign(juce::jmin(std::abs(u), 0.5f - std::abs(u)), u);
+
+    const float x = folded * juce::MathConstants<float>::twoPi;
+    const float x2 = x * x;
+
+    // Minimax coefficients for sin on [-pi/2, pi/2]
+    return x * (0.99999997659155f
+         + x2 * (-0.16666647635470586f
+         + x2 * (0.0083328998347224f
+         + x2 * (-0.00019800898342093f
+         + x2 * 2.5904894855190e-6f))));
+}
+
+inline float FreOscFastMath::sinPolynomial(float radians) noexcept
+{
+    constexpr float inverseTwoPi = 1.0f / juce::MathConstants<float>::twoPi;
+
+    // Reduce to u in [-0.5, 0.5] cycles
+    float u = radians * inverseTwoPi;
+    u -= std::floor(u + 0.5f);
+    return sinPolynomialCycles(u);
+}
+
+inline float FreOscFastMath::sinTable(float radians) noexcept
+{
+    constexpr float inverseTwoPi = 1.0f / juce::MathConstants<float>::twoPi;
+
+    float u = radians * inverseTwoPi;
+    u -= std::floor(u);
+
+    const float position = u * static_cast<float>(tableSize);
+    const int index = juce::jmin(static_cast<int>(position), tableSize - 1);
+    const float fraction = position - static_cast<float>(index);
+
+    const auto* table = getSineTable();
+    return table[index] + (table[index + 1] - table[index]) * fraction;
+}
+
+inline float FreOscFastMath::sin(float radians, Precision precision) noexcept
+{
+    switch (precision)
+    {
+        case Precision::Polynomial: return sinPolynomial(radians);
+        case Precision::Table:      return sinTable(radians);
+        case Precision::Exact:
+        default:                    return std::sin(radians);
+    }
+}
+
+inline float FreOscFastMath::sinPhase(Phase phase, Precision precision) noexcept
+{
+    switch (precision)
+    {
+        case Precision::Polynomial:
+            // The signed phase is already the reduced argument
+            return sinPolynomialCycles(phaseDeltaToCycles(phase));
+
+        case Precision::Table:
+        {
+            // Index from the top bits, interpolation fraction from the rest
+            constexpr int fractionBits = 32 - tableBits;
+            const auto index = static_cast<int>(phase >> fractionBits);
+            const float fraction = static_cast<float>(phase & ((1u << fractionBits) - 1u)) * (1.0f / static_cast<float>(1u << fractionBits));
+
+            const auto* table = getSineTable();
+            return table[index] + (table[index + 1] - table[index]) * fraction;
+        }
+
+        case Precision::Exact:
+        default:
+            return std::sin(phaseToRadians(phase));
+    }
+}
+
+inline float FreOscFastMath::cos(float radians, Precision precision) noexcept
+{
+    if (precision == Precision::Exact)
+        return std::cos(radians);
+
+    return sin(radians + juce::MathConstants<float>::halfPi, precision);
+}
@@ -1,5 +1,167 @@
 #include "FreOscFilter.h"
 
+namespace
+{
+    using Register = juce::dsp::SIMDRegister<float>;
+
+    static_assert(Register::SIMDNumElements >= 2, "The dual filter needs two SIMD lanes");
+
+    // Lane 0 = first filter, lane 1 = second filter, remaining lanes idle
+    Register makePair(float first, float second)
+    {
+        auto pair = Register::expand(0.0f);
+        pair.set(0, first);
+        pair.set(1, second);
+        return pair;
+    }
+
+    // Both filters' states live in z1/z2, so either engine can be stepped, rolled back per lane and stored the same way
+    struct DualBiquad
+    {
+        Register b0, b1, b2, a1, a2, z1, z2;
+
+        DualBiquad(const float* first, const float* second, const float* firstState, const float* secondState, float outputScale)
+            : b0(makePair(first[0], second[0]) * Register::expand(outputScale)),
+              b1(makePair(first[1], second[1]) * Register::expand(outputScale)),
+              b2(makePair(first[2], second[2]) * Register::expand(outputScale)),
+              a1(makePair(first[3], second[3])),
+              a2(makePair(first[4], second[4])),
+              z1(makePair(firstState[0], secondState[0])),
+              z2(makePair(firstState[1], secondState[1]))
+        {
+        }
+
+        Register process(Register input)
+        {
+            const auto output = b0 * input + z1;
+            z1 = b1 * input - a1 * output + z2;
+            z2 = b2 * input - a2 * output;
+            return output;
+        }
+    };
+
+    struct DualStateVariable
+    {
+        Register g1, g2, g3, m0, m1, m2, z1, z2;
+
+        DualStateVariable(const FreOscFilterCoefficients& first, const FreOscFilterCoefficients& second,
+                          const float* firstState, const float* secondState, float outputScale)
+            : g1(makePair(first.svfGains[0], second.svfGains[0])),
+              g2(makePair(first.svfGains[1], second.svfGains[1])),
+              g3(makePair(first.svfGains[2], second.svfGains[2])),
+              m0(makePair(first.svfMix[0], second.svfMix[0]) * Register::expand(outputScale)),
+              m1(makePair(first.svfMix[1], second.svfMix[1]) * Register::expand(outputScale)),
+              m2(makePair(first.svfMix[2], second.svfMix[2]) * Register::expand(outputScale)),
+              z1(makePair(firstState[0], secondState[0])),
+              z2(makePair(firstState[1], secondState[1]))
+        {
+        }
+
+        Register process(Register input)
+        {
+            const auto v3 = input - z2;
+            const auto v1 = g1 * z1 + g2 * v3;          // Band
+            const auto v2 = z2 + g2 * z1 + g3 * v3;     // Low
+            z1 = v1 + v1 - z1;
+            z2 = v2 + v2 - z2;
+            return m0 * input + m1 * v1 + m2 * v2;
+        }
+    };
+
+    template <typename Dual>
+    void runParallel(Dual& dual, float* samples, int numSamples)
+    {
+        // Both lanes see the same input; the 0.5 mix is folded into the output coefficients
+        for (int i = 0; i < numSamples; ++i)
+        {
+            const auto output = dual.process(Register::expand(samples[i]));
+            samples[i] = output.get(0) + output.get(1);
+        }
+    }
+
+    // Steps the pair, then restores the states of the lane that had no input
+    template <typename Dual>
+    Register stepOneLane(Dual& dual, Register input, size_t idleLane)
+    {
+        const float z1 = dual.z1.get(idleLane), z2 = dual.z2.get(idleLane);
+        const auto output = dual.process(input);
+        dual.z1.set(idleLane, z1);
+        dual.z2.set(idleLane, z2);
+        return output;
+    }
+
+    template <typename Dual>
+    void runSeries(Dual& dual, float* samples, int numSamples)
+    {
+        if (numSamples <= 0)
+            return;
+
+        // Two-stage pipeline: each step runs the first filter on sample n and the second
+        // filter on the first filter's output for sample n - 1, so both stay in registers
+        float carry = stepOneLane(dual, makePair(samples[0], 0.0f), 1).get(0);
+
+        for (int i = 1; i < numSamples; ++i)
+        {
+            const auto output = dual.process(makePair(samples[i], carry));
+            samples[i - 1] = output.get(1);
+            carry = output.get(0);
+        }
+
+        // Drain the pipeline - the second filter on the last output of the first
+        samples[numSamples - 1] = stepOneLane(dual, makePair(0.0f, carry), 0).get(1);
+    }
+
+    template <typename Dual>
+    void storeStates(const Dual& dual, float* firstState, float* secondState)
+    {
+        firstState[0] = dual.z1.get(0);
+        firstState[1] = dual.z2.get(0);
+        secondState[0] = dual.z1.get(1);
+        secondState[1] = dual.z2.get(1);
+    }
+}
+
+//==============================================================================
+void FreOscFilterTables::prepare(double newSampleRate)
+{
+    if (newSampleRate == sampleRate)
+        return;
+
+    sampleRate = newSampleRate;
+
+    for (int index = 0; index <= tableSize; ++index)
+    {
+        const auto prewarp = computePrewarp(static_cast<float>(index) / static_cast<float>(tableSize), sampleRate);
+        tangents[index] = prewarp.tangent;
+        inverseTangents[index] = prewarp.inverseTangent;
+    }
+}
+
+FreOscFilterTables::Prewarp FreOscFilterTables::lookup(float normalizedCutoff) const
+{
+    const float position = juce::jlimit(0.0f, 1.0f, normalizedCutoff) * static_cast<float>(tableSize);
+    const int index = juce::jmin(static_cast<int>(position), tableSize - 1);
+    const float fraction = position - static_cast<float>(index);
+
+    Prewarp prewarp;
+    prewarp.tangent = tangents[index] + fraction * (tangents[index + 1] - tangents[index]);
+    prewarp.inverseTangent = inverseTangents[index] + fraction * (inverseTangents[index + 1] - inverseTangents[index]);
+    return prewarp;
+}
+
+FreOscFilterTables::Prewarp FreOscFilterTables::computePrewarp(float normalizedCutoff, double sampleRate)
+{
+    // Same cutoff mapping as the filter, kept below Nyquist
+    const double frequency = juce::jlimit(20.0, sampleRate * 0.45,
+                                          static_cast<double>(FreOscFilter::normalizedToFrequency(normalizedCutoff)));
+    const double tangent = std::tan(juce::MathConstants<double>::pi * frequency / sampleRate);
+
+    Prewarp prewarp;
+    prewarp.tangent = static_cast<float>(tangent);
+    prewarp.inverseTangent = static_cast<float>(1.0 / tangent);
+    return prewarp;
+}
+
 
 //==============================================================================
 FreOscFilter::FreOscFilter()
@@ -15,40 +177,204 @@ void FreOscFilter::prepare(const juce::dsp::ProcessSpec& spec)
 {
     sampleRate = spec.sampleRate;
 
-    // Prepare main filter
-    mainFilter.prepare(spec);
+    // The filter is always mono - the voice path is mono until panning
+    reset();
 
-    // Initialize with current settings
-    updateFilterCoefficients();
+    // Coefficients for the new rate are designed when the filter next runs
+    designDirty = true;
 }
 
 void FreOscFilter::reset()
 {
-    mainFilter.reset();
+    state[0] = state[1] = 0.0f;
+    svfState[0] = svfState[1] = 0.0f;
 }
 
 void FreOscFilter::process(const juce::dsp::ProcessContextReplacing<float>& context)
 {
-    // First apply the IIR filtering
-    mainFilter.process(context);
-    
-    // Then apply filter gain (if not unity gain)
-    float gainDb = normalizedToGainDb(currentGainNormalized);
-    if (std::abs(gainDb) > 0.1f) // Only apply gain if it's not near 0dB
-    {
-        float linearGain = juce::Decibels::decibelsToGain(gainDb);
-        
-        // Apply gain to all channels and samples
-        auto& audioBlock = context.getOutputBlock();
-        for (size_t channel = 0; channel < audioBlock.getNumChannels(); ++channel)
-        {
-            auto* channelData = audioBlock.getChannelPointer(channel);
-            for (size_t sample = 0; sample < audioBlock.getNumSamples(); ++sample)
-            {
-                channelData[sample] *= linearGain;
-            }
-        }
+    auto& audioBlock = context.getOutputBlock();
+    jassert(audioBlock.getNumChannels() == 1);
+
+    if (context.isBypassed)
+        return;
+
+    processBlock(audioBlock.getChannelPointer(0), static_cast<int>(audioBlock.getNumSamples()));
+}
+
+float FreOscFilter::processSample(float sample)
+{
+    return processDesignSample(getCoefficients(), sample);
+}
+
+void FreOscFilter::processBlock(float* samples, int numSamples)
+{
+    const auto& coefficients = getCoefficients();
+
+    if (currentEngine == StateVariable)
+        processStateVariableBlock(samples, numSamples, coefficients.svfGains, coefficients.svfMix);
+    else
+        processBiquadBlock(samples, numSamples, coefficients.biquad);
+}
+
+void FreOscFilter::processBlockWithCutoff(float* samples, const float* normalizedCutoffs, int numSamples)
+{
+    // Per-voice cutoffs never match a shared design - always run on the private one
+    for (int i = 0; i < numSamples; ++i)
+    {
+        // Only redesign when the cutoff actually moved
+        setCutoffFrequency(normalizedCutoffs[i]);
+        if (designDirty)
+            computeCoefficients();
+
+        samples[i] = processDesignSample(design, samples[i]);
+    }
+
+    snapStateToZero();
+}
+
+float FreOscFilter::processDesignSample(const FreOscFilterCoefficients& coefficients, float sample)
+{
+    if (currentEngine == StateVariable)
+    {
+        const auto* gains = coefficients.svfGains;
+        const auto* mix = coefficients.svfMix;
+        const float v3 = sample - svfState[1];
+        const float v1 = gains[0] * svfState[0] + gains[1] * v3;
+        const float v2 = svfState[1] + gains[1] * svfState[0] + gains[2] * v3;
+        svfState[0] = 2.0f * v1 - svfState[0];
+        svfState[1] = 2.0f * v2 - svfState[1];
+        return mix[0] * sample + mix[1] * v1 + mix[2] * v2;
+    }
+
+    const auto* biquad = coefficients.biquad;
+    const float output = biquad[0] * sample + state[0];
+    state[0] = biquad[1] * sample - biquad[3] * output + state[1];
+    state[1] = biquad[2] * sample - biquad[4] * output;
+    return output;
+}
+
+void FreOscFilter::processBiquadBlock(float* samples, int numSamples, const float* coefficients)
+{
+    const float b0 = coefficients[0], b1 = coefficients[1], b2 = coefficients[2];
+    const float a1 = coefficients[3], a2 = coefficients[4];
+    float s1 = state[0], s2 = state[1];
+
+    for (int i = 0; i < numSamples; ++i)
+    {
+        const float input = samples[i];
+        const float output = b0 * input + s1;
+        s1 = b1 * input - a1 * output + s2;
+        s2 = b2 * input - a2 * output;
+        samples[i] = output;
     }
+
+    state[0] = s1;
+    state[1] = s2;
+    snapStateToZero();
+}
+
+void FreOscFilter::processStateVariableBlock(float* samples, int numSamples, const float* gains, const float* mix)
+{
+    const float a1 = gains[0], a2 = gains[1], a3 = gains[2];
+    const float m0 = mix[0], m1 = mix[1], m2 = mix[2];
+    float ic1eq = svfState[0], ic2eq = svfState[1];
+
+    for (int i = 0; i < numSamples; ++i)
+    {
+        const float input = samples[i];
+        const float v3 = input - ic2eq;
+        const float v1 = a1 * ic1eq + a2 * v3;     // Band
+        const float v2 = ic2eq + a2 * ic1eq + a3 * v3;  // Low
+        ic1eq = 2.0f * v1 - ic1eq;
+        ic2eq = 2.0f * v2 - ic2eq;
+        samples[i] = m0 * input + m1 * v1 + m2 * v2;
+    }
+
+    svfState[0] = ic1eq;
+    svfState[1] = ic2eq;
+    snapStateToZero();
+}
+
+bool FreOscFilter::sharesTuningWith(const FreOscFilter& other) const
+{
+    return currentEngine == StateVariable && other.currentEngine == StateVariable
+        && sampleRate == other.sampleRate
+        && currentCutoffNormalized == other.currentCutoffNormalized
+        && currentResonanceNormalized == other.currentResonanceNormalized;
+}
+
+void FreOscFilter::processParallelWith(FreOscFilter& other, float* samples, int numSamples)
+{
+    jassert(sharesTuningWith(other));
+
+    // Both outputs are mixes of the same band and low signals, so the averaged output is one mix
+    const auto& coefficients = getCoefficients();
+    const auto& otherCoefficients = other.getCoefficients();
+    const float mix[3] = { (coefficients.svfMix[0] + otherCoefficients.svfMix[0]) * 0.5f,
+                           (coefficients.svfMix[1] + otherCoefficients.svfMix[1]) * 0.5f,
+                           (coefficients.svfMix[2] + otherCoefficients.svfMix[2]) * 0.5f };
+
+    processStateVariableBlock(samples, numSamples, coefficients.svfGains, mix);
+
+    // The other filter saw the same input, so it carries on from the same state
+    other.svfState[0] = svfState[0];
+    other.svfState[1] = svfState[1];
+}
+
+void FreOscFilter::processDualParallel(FreOscFilter& first, FreOscFilter& second, float* samples, int numSamples)
+{
+    jassert(first.currentEngine == second.currentEngine);
+
+    const auto& firstCoefficients = first.getCoefficients();
+    const auto& secondCoefficients = second.getCoefficients();
+
+    if (first.currentEngine == StateVariable)
+    {
+        DualStateVariable dual(firstCoefficients, secondCoefficients, first.svfState, second.svfState, 0.5f);
+        runParallel(dual, samples, numSamples);
+        storeStates(dual, first.svfState, second.svfState);
+    }
+    else
+    {
+        DualBiquad dual(firstCoefficients.biquad, secondCoefficients.biquad, first.state, second.state, 0.5f);
+        runParallel(dual, samples, numSamples);
+        storeStates(dual, first.state, second.state);
+    }
+
+    first.snapStateToZero();
+    second.snapStateToZero();
+}
+
+void FreOscFilter::processDualSeries(FreOscFilter& first, FreOscFilter& second, float* samples, int numSamples)
+{
+    jassert(first.currentEngine == second.currentEngine);
+
+    const auto& firstCoefficients = first.getCoefficients();
+    const auto& secondCoefficients = second.getCoefficients();
+
+    if (first.currentEngine == StateVariable)
+    {
+        DualStateVariable dual(firstCoefficients, secondCoefficients, first.svfState, second.svfState, 1.0f);
+        runSeries(dual, samples, numSamples);
+        storeStates(dual, first.svfState, second.svfState);
+    }
+    else
+    {
+        DualBiquad dual(firstCoefficients.biquad, secondCoefficients.biquad, first.state, second.state, 1.0f);
+        runSeries(dual, samples, numSamples);
+        storeStates(dual, first.state, second.state);
+    }
+
+    first.snapStateToZero();
+    second.snapStateToZero();
+}
+
+void FreOscFilter::snapStateToZero()
+{
+    for (auto* values : { state, svfState })
+        for (int i = 0; i < 2; ++i)
+            if (! (values[i] < -1.0e-8f || values[i] > 1.0e-8f))
+                values[i] = 0.0f;
 }
 
 //==============================================================================
@@ -57,7 +383,7 @@ void FreOscFilter::setFilterType(FilterType newType)
     if (currentFilterType != newType)
     {
         currentFilterType = newType;
-        updateFilterCoefficients();
+        designDirty = true;
     }
 }
 
@@ -67,7 +393,7 @@ void FreOscFilter::setCutoffFrequency(float normalizedFreq)
     if (std::abs(currentCutoffNormalized - normalizedFreq) > 1e-6f)
     {
         currentCutoffNormalized = normalizedFreq;
-        updateFilterCoefficients();
+        designDirty = true;
     }
 }
 
@@ -77,7 +403,7 @@ void FreOscFilter::setResonance(float normalizedQ)
     if (std::abs(currentResonanceNormalized - normalizedQ) > 1e-6f)
     {
         currentResonanceNormalized = normalizedQ;
-        updateFilterCoefficients();
+        designDirty = true;
     }
 }
 
@@ -87,58 +413,196 @@ void FreOscFilter::setGain(float normalizedGain)
     if (std::abs(currentGainNormalized - normalizedGain) > 1e-6f)
     {
         currentGainNormalized = normalizedGain;
-        updateFilterCoefficients();
+
+        // Cache linear filter gain (only applied if not near 0dB)
+        float gainDb = normalizedToGainDb(currentGainNormalized);
+        linearGain = (std::abs(gainDb) > 0.1f) ? juce::Decibels::decibelsToGain(gainDb) : 1.0f;
+        designDirty = true;
     }
 }
 
-
-//==============================================================================
-void FreOscFilter::updateFilterCoefficients()
+void FreOscFilter::setEngine(FilterEngine newEngine)
 {
-    auto coefficients = createFilterCoefficients();
-    if (coefficients != nullptr)
+    if (currentEngine != newEngine)
     {
-        *mainFilter.state = *coefficients;
+        currentEngine = newEngine;
+        reset();
+        designDirty = true;
     }
 }
 
-juce::dsp::IIR::Coefficients<float>::Ptr FreOscFilter::createFilterCoefficients()
+void FreOscFilter::setTables(const FreOscFilterTables* newTables)
 {
-    float freq = normalizedToFrequency(currentCutoffNormalized);
-    float q = normalizedToQ(currentResonanceNormalized);
+    tables = newTables;
+}
 
-    // Ensure frequency is within valid range
-    freq = juce::jlimit(20.0f, static_cast<float>(sampleRate * 0.45), freq);
-    q = juce::jmax(0.1f, q);
+void FreOscFilter::setSharedCoefficients(const FreOscFilterCoefficients* coefficients)
+{
+    shared = coefficients;
+}
+
+//==============================================================================
+const FreOscFilterCoefficients& FreOscFilter::getCoefficients()
+{
+    if (shared != nullptr && isDesignedFor(*shared))
+        return *shared;
+
+    if (designDirty)
+        computeCoefficients();
+
+    return design;
+}
+
+bool FreOscFilter::isDesignedFor(const FreOscFilterCoefficients& coefficients) const
+{
+    return coefficients.sampleRate == sampleRate
+        && coefficients.engine == static_cast<int>(currentEngine)
+        && coefficients.type == static_cast<int>(currentFilterType)
+        && coefficients.cutoff == currentCutoffNormalized
+        && coefficients.resonance == currentResonanceNormalized
+        && coefficients.gain == currentGainNormalized;
+}
 
+void FreOscFilter::computeCoefficients()
+{
+    if (currentEngine == StateVariable)
+        computeStateVariableCoefficients();
+    else
+        computeBiquadCoefficients();
+
+    design.engine = static_cast<int>(currentEngine);
+    design.type = static_cast<int>(currentFilterType);
+    design.cutoff = currentCutoffNormalized;
+    design.resonance = currentResonanceNormalized;
+    design.gain = currentGainNormalized;
+    design.sampleRate = sampleRate;
+    designDirty = false;
+}
+
+void FreOscFilter::computeStateVariableCoefficients()
+{
+    // No Q clamps - the state variable filter stays stable across the whole range
+    const float damping = 1.0f / juce::jmax(0.1f, normalizedToQ(currentResonanceNormalized));
+    const float g = getPrewarp(currentCutoffNormalized).tangent;
+    auto* svfGains = design.svfGains;
+    auto* svfMix = design.svfMix;
+    svfGains[0] = 1.0f / (1.0f + g * (g + damping));
+    svfGains[1] = g * svfGains[0];
+    svfGains[2] = g * svfGains[1];
+
+    // Every type is a mix of input, band and low: high = input - k * band - low
     switch (currentFilterType)
     {
+        case Highpass:  svfMix[0] = 1.0f; svfMix[1] = -damping; svfMix[2] = -1.0f; break;
+        case Bandpass:  svfMix[0] = 0.0f; svfMix[1] = damping;  svfMix[2] = 0.0f;  break; // Unity gain at the centre, as the biquad
+        case Notch:     svfMix[0] = 1.0f; svfMix[1] = -damping; svfMix[2] = 0.0f;  break;
         case Lowpass:
-            // Low-pass filters are prone to instability at high Q - limit to 2.5 for clean sound
-            q = juce::jmin(q, 2.5f);
-            // Also ensure minimum frequency when Q is high to prevent very low freq + high Q instability
-            if (q > 2.0f && freq < 50.0f)
-                freq = 50.0f;
-            return juce::dsp::IIR::Coefficients<float>::makeLowPass(sampleRate, freq, q);
+        default:        svfMix[0] = 0.0f; svfMix[1] = 0.0f;     svfMix[2] = 1.0f;  break;
+    }
+
+    for (int i = 0; i < 3; ++i)
+        svfMix[i] *= linearGain;
+}
+
+void FreOscFilter::computeBiquadCoefficients()
+{
+    float cutoff = currentCutoffNormalized;
+    float q = juce::jmax(0.1f, normalizedToQ(currentResonanceNormalized));
 
+    if (currentFilterType == Lowpass)
+    {
+        // Low-pass filters are prone to instability at high Q - limit to 2.5 for clean sound
+        q = juce::jmin(q, 2.5f);
+        // Also ensure minimum frequency (50Hz) when Q is high to prevent very low freq + high Q instability
+        if (q > 2.0f)
+            cutoff = juce::jmax(cutoff, 0.1326467f);
+    }
+
+    // Bilinear-transform designs, as juce::dsp::IIR::Coefficients builds them, but written
+    // straight into the filter state with no Coefficients object in between
+    const float invQ = 1.0f / q;
+    const auto prewarp = getPrewarp(cutoff);
+    float b0, b1, b2, a0, a1, a2;
+
+    switch (currentFilterType)
+    {
         case Highpass:
-            return juce::dsp::IIR::Coefficients<float>::makeHighPass(sampleRate, freq, q);
+        {
+            const float n = prewarp.tangent;
+            const float nSquared = n * n;
+            b0 = 1.0f;
+            b1 = -2.0f;
+            b2 = 1.0f;
+            a0 = 1.0f + n * invQ + nSquared;
+            a1 = 2.0f * (nSquared - 1.0f);
+            a2 = 1.0f - n * invQ + nSquared;
+            break;
+        }
 
         case Bandpass:
-            return juce::dsp::IIR::Coefficients<float>::makeBandPass(sampleRate, freq, q);
+        {
+            const float n = prewarp.inverseTangent;
+            const float nSquared = n * n;
+            b0 = n * invQ;
+            b1 = 0.0f;
+            b2 = -n * invQ;
+            a0 = 1.0f + n * invQ + nSquared;
+            a1 = 2.0f * (1.0f - nSquared);
+            a2 = 1.0f - n * invQ + nSquared;
+            break;
+        }
 
         case Notch:
-            return juce::dsp::IIR::Coefficients<float>::makeNotch(sampleRate, freq, q);
+        {
+            const float n = prewarp.inverseTangent;
+            const float nSquared = n * n;
+            b0 = 1.0f + nSquared;
+            b1 = 2.0f * (1.0f - nSquared);
+            b2 = b0;
+            a0 = 1.0f + n * invQ + nSquared;
+            a1 = b1;
+            a2 = 1.0f - n * invQ + nSquared;
+            break;
+        }
 
+        case Lowpass:
         default:
-            return juce::dsp::IIR::Coefficients<float>::makeLowPass(sampleRate, freq, q);
+        {
+            const float n = prewarp.inverseTangent;
+            const float nSquared = n * n;
+            b0 = 1.0f;
+            b1 = 2.0f;
+            b2 = 1.0f;
+            a0 = 1.0f + n * invQ + nSquared;
+            a1 = 2.0f * (1.0f - nSquared);
+            a2 = 1.0f - n * invQ + nSquared;
+            break;
+        }
     }
+
+    // Normalise by a0 and fold the output gain into the feed-forward taps
+    const float invA0 = 1.0f / a0;
+    const float feedForwardScale = linearGain * invA0;
+
+    design.biquad[0] = b0 * feedForwardScale;
+    design.biquad[1] = b1 * feedForwardScale;
+    design.biquad[2] = b2 * feedForwardScale;
+    design.biquad[3] = a1 * invA0;
+    design.biquad[4] = a2 * invA0;
+}
+
+FreOscFilterTables::Prewarp FreOscFilter::getPrewarp(float normalizedCutoff) const
+{
+    if (tables != nullptr && tables->getSampleRate() == sampleRate)
+        return tables->lookup(normalizedCutoff);
+
+    return FreOscFilterTables::computePrewarp(normalizedCutoff, sampleRate);
 }
 
 //==============================================================================
 // Frequency conversion utilities with proper logarithmic scaling
 
-float FreOscFilter::normalizedToFrequency(float normalized) const
+float FreOscFilter::normalizedToFrequency(float normalized)
 {
     // Logarithmic scaling from 20Hz to 20kHz
     normalized = juce::jlimit(0.0f, 1.0f, normalized);
@@ -2,6 +2,45 @@
 
 #include <juce_audio_basics/juce_audio_basics.h>
 #include <juce_dsp/juce_dsp.h>
+#include <cmath>
+#include "FreOscFilterCoefficients.h"
+
+//==============================================================================
+/**
+    Prewarped cutoff tables for FreOscFilter: normalised cutoff (0-1) straight
+    to tan(pi * f / fs) and its reciprocal, the terms both filter engines are
+    designed from. One instance is owned by the processor, rebuilt when the
+    sample rate changes and shared read-only by every voice's filters, so a
+    modulated cutoff costs an interpolated lookup instead of pow() and tan().
+*/
+class FreOscFilterTables
+{
+public:
+    //==============================================================================
+    static constexpr int tableSize = 1024;
+
+    struct Prewarp
+    {
+        float tangent = 0.0f;           // tan(pi * f / fs)
+        float inverseTangent = 0.0f;    // 1 / tan(pi * f / fs)
+    };
+
+    //==============================================================================
+    // Rebuilds the tables if the sample rate changed (not while the audio thread renders)
+    void prepare(double newSampleRate);
+
+    double getSampleRate() const { return sampleRate; }
+    Prewarp lookup(float normalizedCutoff) const;   // Linear interpolation between entries
+
+    // Direct evaluation, including the 20 Hz - 0.45 * fs clamp the filters apply
+    static Prewarp computePrewarp(float normalizedCutoff, double sampleRate);
+
+private:
+    //==============================================================================
+    double sampleRate = 0.0;
+    float tangents[tableSize + 1] = {};
+    float inverseTangents[tableSize + 1] = {};
+};
 
 //==============================================================================
 /**
@@ -15,6 +54,17 @@
     1 - Highpass: Standard high-pass filter
     2 - Bandpass: Standard band-pass filter
     3 - Notch: Standard notch filter (band-stop)
+
+    Two engines share those types: an RBJ biquad (transposed direct form II)
+    and a zero-delay-feedback state variable filter (topology-preserving
+    transform). The state variable filter needs a single prewarp per cutoff
+    change, stays stable under per-sample cutoff modulation without the
+    biquad's Q clamps, and produces every type from one pass.
+
+    Setters only record the new settings; coefficients are designed when the
+    filter next runs. A filter given shared coefficients (see
+    setSharedCoefficients) runs on them whenever they were designed for its
+    current settings and never designs its own.
 */
 class FreOscFilter
 {
@@ -28,6 +78,12 @@ public:
         Notch
     };
 
+    enum FilterEngine
+    {
+        Biquad = 0,
+        StateVariable
+    };
+
     //==============================================================================
     FreOscFilter();
     ~FreOscFilter();
@@ -37,18 +93,52 @@ public:
     void reset();
     void process(const juce::dsp::ProcessContextReplacing<float>& context);
 
+    // Raw mono processing for the voice render pipeline (no AudioBlock wrapper)
+    float processSample(float sample);
+    void processBlock(float* samples, int numSamples);
+    void processBlockWithCutoff(float* samples, const float* normalizedCutoffs, int numSamples); // Per-sample cutoff modulation
+
     //==============================================================================
     // Parameter setters - all expect normalized values (0.0-1.0)
     void setFilterType(FilterType newType);
     void setCutoffFrequency(float normalizedFreq);  // 0.0-1.0 -> 20Hz-20kHz
     void setResonance(float normalizedQ);           // 0.0-1.0 -> 0.1-5.0
     void setGain(float normalizedGain);             // 0.0-1.0 -> -24dB to +24dB
+    void setEngine(FilterEngine newEngine);         // Clears the filter state when it changes
+
+    // Shared cutoff tables; used while their sample rate matches the filter's
+    void setTables(const FreOscFilterTables* newTables);
+
+    // Coefficients designed elsewhere for the same settings (nullptr = none). The
+    // pointer must stay valid until the next call; voices set it every block
+    void setSharedCoefficients(const FreOscFilterCoefficients* coefficients);
 
     // Parameter getters
     FilterType getFilterType() const { return currentFilterType; }
     float getCutoffFrequency() const { return currentCutoffNormalized; }
     float getResonance() const { return currentResonanceNormalized; }
     float getGain() const { return currentGainNormalized; }
+    FilterEngine getEngine() const { return currentEngine; }
+
+    // Parallel routing in one pass: when both are state variable filters with the same
+    // cutoff and resonance, their outputs come from the same integrators
+    bool sharesTuningWith(const FreOscFilter& other) const;
+    void processParallelWith(FreOscFilter& other, float* samples, int numSamples); // Writes (this + other) * 0.5
+
+    // Both filters of the Parallel or Series routing in one pass, their states side by
+    // side in SIMD lanes. Both must use the same engine; cutoffs stay fixed for the block
+    static void processDualParallel(FreOscFilter& first, FreOscFilter& second, float* samples, int numSamples); // (first + second) * 0.5
+    static void processDualSeries(FreOscFilter& first, FreOscFilter& second, float* samples, int numSamples);
+
+    // The design for the current settings, shared or private (designed now if needed)
+    const FreOscFilterCoefficients& getCoefficients();
+
+    // Normalised biquad coefficients { b0, b1, b2, a1, a2 } with the output gain folded
+    // into b0-b2, for engines that run the same filter over their own state
+    const float* getRawCoefficients() { return getCoefficients().biquad; }
+
+    // Normalized cutoff (0.0-1.0) to Hz, logarithmic from 20Hz to 20kHz
+    static float normalizedToFrequency(float normalized);
 
 private:
     //==============================================================================
@@ -57,18 +147,34 @@ private:
     float currentCutoffNormalized = 0.5f;     // 0.0-1.0
     float currentResonanceNormalized = 0.1f;  // 0.0-1.0
     float currentGainNormalized = 0.5f;       // 0.0-1.0
+    FilterEngine currentEngine = Biquad;
+    const FreOscFilterTables* tables = nullptr;
     double sampleRate = 44100.0;
+    float linearGain = 1.0f;                  // Cached from currentGainNormalized
 
-    // Single unified filter for all types (stereo using ProcessorDuplicator)
-    juce::dsp::ProcessorDuplicator<juce::dsp::IIR::Filter<float>, juce::dsp::IIR::Coefficients<float>> mainFilter;
+    // Single unified mono filter for all types (each voice owns its own instance).
+    // Coefficients are computed in place, so modulating the cutoff never allocates
+    FreOscFilterCoefficients design;                        // Private design
+    const FreOscFilterCoefficients* shared = nullptr;
+    bool designDirty = true;                                // Settings moved since the private design
+
+    float state[2] = {};        // Biquad, transposed direct form II
+    float svfState[2] = {};     // State variable filter integrators { ic1eq, ic2eq }
 
     //==============================================================================
     // Helper methods
-    void updateFilterCoefficients();
-    juce::dsp::IIR::Coefficients<float>::Ptr createFilterCoefficients();
+    bool isDesignedFor(const FreOscFilterCoefficients& coefficients) const;
+    void computeCoefficients();
+    void computeBiquadCoefficients();
+    void computeStateVariableCoefficients();
+    void snapStateToZero();
+    FreOscFilterTables::Prewarp getPrewarp(float normalizedCutoff) const;
+
+    float processDesignSample(const FreOscFilterCoefficients& coefficients, float sample);
+    void processBiquadBlock(float* samples, int numSamples, const float* coefficients);
+    void processStateVariableBlock(float* samples, int numSamples, const float* gains, const float* mix);
 
-    // Frequency conversion utilities
-    float normalizedToFrequency(float normalized) const;
+    // Parameter conversion utilities
     float normalizedToQ(float normalized) const;
     float normalizedToGainDb(float normalized) const;
 
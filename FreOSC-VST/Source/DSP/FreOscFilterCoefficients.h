@@ -0,0 +1,38 @@
+#pragma once
+
+#include <juce_core/juce_core.h>
+#include <type_traits>
+
+//==============================================================================
+/**
+    FreOSC Filter Coefficients
+
+    One FreOscFilter design: the settings it was made for and the resulting
+    biquad and state variable filter coefficients, output gain folded in.
+
+    The processor designs filter 1 and filter 2 once per parameter change and
+    publishes them in the voice parameter snapshot. Every voice filter whose
+    own settings match a design runs on it instead of designing its own, so
+    only voices with per-voice cutoff modulation compute private coefficients.
+*/
+struct FreOscFilterCoefficients
+{
+    // Design key - engine and type indices, normalised settings and sample rate
+    int engine = 0;
+    int type = 0;
+    float cutoff = 0.0f;
+    float resonance = 0.0f;
+    float gain = 0.0f;
+    double sampleRate = 0.0;   // 0 = nothing designed yet
+
+    // Biquad { b0, b1, b2, a1, a2 }, normalised, output gain folded into b0-b2
+    float biquad[5] = { 1.0f, 0.0f, 0.0f, 0.0f, 0.0f };
+
+    // State variable filter integrator gains { a1, a2, a3 } and output mix of
+    // { input, band, low }, output gain folded in
+    float svfGains[3] = {};
+    float svfMix[3] = { 0.0f, 0.0f, 1.0f };
+};
+
+static_assert(std::is_trivially_copyable<FreOscFilterCoefficients>::value,
+              "Filter coefficients travel in the voice parameter snapshot");
@@ -0,0 +1,43 @@
+#include "FreOscHalfBandDecimator.h"
+
+//==============================================================================
+// Odd taps h[1], h[3], ... h[29] of the half-band filter (h[0] = 0.5, even taps zero)
+const float FreOscHalfBandDecimator::sideTaps[numSideTaps] =
+{
+     3.166135513e-01f, -1.011104948e-01f,  5.565052388e-02f, -3.487147154e-02f,
+     2.271036317e-02f, -1.480894195e-02f,  9.468222309e-03f, -5.846351564e-03f,
+     3.438873418e-03f, -1.897927491e-03f,  9.635989978e-04f, -4.368238928e-04f,
+     1.676584535e-04f, -4.824340648e-05f,  6.259664651e-06f
+};
+
+//==============================================================================
+void FreOscHalfBandDecimator::reset()
+{
+    std::fill(std::begin(buffer), std::end(buffer), 0.0f);
+}
+
+void FreOscHalfBandDecimator::process(const float* input, float* output, int numInputSamples)
+{
+    jassert(numInputSamples % 2 == 0 && numInputSamples <= maxInputSamples);
+
+    std::copy(input, input + numInputSamples, buffer + historySize);
+
+    for (int outputSample = 0; outputSample < numInputSamples / 2; ++outputSample)
+    {
+        // Window of numTaps inputs ending at the newest sample for this output. Starting
+        // one sample in puts the centre tap on an even input, for a whole-sample delay
+        const float* window = buffer + 2 * outputSample + 1;
+
+        float sum = 0.5f * window[centreTap];
+        for (int tap = 0; tap < numSideTaps; ++tap)
+        {
+            const int offset = 2 * tap + 1;
+            sum += sideTaps[tap] * (window[centreTap - offset] + window[centreTap + offset]);
+        }
+
+        output[outputSample] = sum;
+    }
+
+    // Keep the newest inputs as history for the next block
+    std::copy(buffer + numInputSamples, buffer + numInputSamples + historySize, buffer);
+}
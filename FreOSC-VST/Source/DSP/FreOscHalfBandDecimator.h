@@ -0,0 +1,50 @@
+#pragma once
+
+#include <juce_core/juce_core.h>
+
+//==============================================================================
+/**
+    FreOSC Half-Band Decimator
+
+    Polyphase half-band FIR that halves the sample rate. Every other tap of a
+    half-band filter is zero, so one polyphase branch is the centre tap alone
+    and the other holds the symmetric odd taps. Each output therefore costs
+    15 multiplies.
+
+    59 taps (Kaiser windowed sinc): passband to 0.4 of the output rate within
+    0.002 dB, stopband above 0.6 of the output rate at least 76 dB down.
+    The coefficients are shared by all instances. Cascade two for 4x.
+
+    Each output is centred on the first input of its pair, so the group delay
+    is a whole number of output samples (outputDelay) and signals that were
+    never oversampled can be lined up with a plain delay line.
+*/
+class FreOscHalfBandDecimator
+{
+public:
+    //==============================================================================
+    static constexpr int numTaps = 59;
+    static constexpr int maxInputSamples = 256;
+    static constexpr int outputDelay = (numTaps - 1) / 4;   // Group delay in output samples
+
+    //==============================================================================
+    void reset();
+
+    // numInputSamples must be even and at most maxInputSamples. Writes
+    // numInputSamples / 2 samples; output may point at input.
+    void process(const float* input, float* output, int numInputSamples);
+
+private:
+    //==============================================================================
+    static constexpr int historySize = numTaps - 1;
+    static constexpr int centreTap = historySize / 2;
+    static constexpr int numSideTaps = (centreTap + 1) / 2;   // Odd offsets 1, 3, ... centreTap
+
+    static const float sideTaps[numSideTaps];
+
+    // Last historySize inputs followed by the current block
+    float buffer[historySize + maxInputSamples] = {};
+
+    //==============================================================================
+    JUCE_LEAK_DETECTOR(FreOscHalfBandDecimator)
+};
@@ -3,9 +3,6 @@
 //==============================================================================
 FreOscLFO::FreOscLFO()
 {
-    // Initialize oscillator with sine wave
-    oscillator.initialise([](float x) { return std::sin(x); });
-
     // Initialize random generator
     random.setSeedRandomly();
 }
@@ -19,13 +16,6 @@ void FreOscLFO::prepare(double newSampleRate)
 {
     sampleRate = newSampleRate;
 
-    // Prepare JUCE oscillator
-    juce::dsp::ProcessSpec spec;
-    spec.sampleRate = sampleRate;
-    spec.maximumBlockSize = 512;
-    spec.numChannels = 1;
-    oscillator.prepare(spec);
-
     // Update phase increment and random step size
     updatePhaseIncrement();
     samplesPerRandomStep = static_cast<int>(sampleRate / (rate * 20.0f)); // 20 steps per cycle
@@ -35,8 +25,7 @@ void FreOscLFO::prepare(double newSampleRate)
 
 void FreOscLFO::reset()
 {
-    oscillator.reset();
-    phase = 0.0f;
+    phase = 0;
     randomValue = 0.0f;
     samplesSinceLastRandom = 0;
 }
@@ -44,34 +33,8 @@ void FreOscLFO::reset()
 //==============================================================================
 void FreOscLFO::setWaveform(Waveform waveform)
 {
-    if (currentWaveform != waveform)
-    {
-        currentWaveform = waveform;
-
-        // Update JUCE oscillator waveform for standard types
-        switch (waveform)
-        {
-            case Waveform::Sine:
-                oscillator.initialise([](float x) { return std::sin(x); });
-                break;
-            case Waveform::Triangle:
-                oscillator.initialise([](float x) {
-                    return juce::jmap(std::abs(x), 0.0f, juce::MathConstants<float>::pi, -1.0f, 1.0f);
-                });
-                break;
-            case Waveform::Sawtooth:
-                oscillator.initialise([](float x) {
-                    return juce::jmap(x, -juce::MathConstants<float>::pi, juce::MathConstants<float>::pi, -1.0f, 1.0f);
-                });
-                break;
-            case Waveform::Square:
-                oscillator.initialise([](float x) { return x < 0.0f ? -1.0f : 1.0f; });
-                break;
-            case Waveform::Random:
-                // Random uses custom generation, no need to set oscillator
-                break;
-        }
-    }
+    // Waveforms are enum-selected kernels - switching never allocates
+    currentWaveform = waveform;
 }
 
 void FreOscLFO::setRate(float rateHz)
@@ -96,9 +59,16 @@ void FreOscLFO::setAmount(float newAmount)
     amount = juce::jlimit(0.0f, 1.0f, newAmount);
 }
 
+void FreOscLFO::setTrigPrecision(FreOscFastMath::Precision precision)
+{
+    trigPrecision = precision;
+}
+
 //==============================================================================
-float FreOscLFO::getNextSample(Waveform waveform, float rateHz, Target target)
+float FreOscLFO::getNextSample(Waveform waveform, float rateHz, Target target, int numSamplesToAdvance)
 {
+    samplesPerStep = juce::jmax(1, numSamplesToAdvance);
+
     // Update parameters if changed
     if (std::abs(rateHz - rate) > 1e-6f)
         setRate(rateHz);
@@ -140,42 +110,36 @@ float FreOscLFO::getNextSample(Waveform waveform, float rateHz, Target target)
 
 float FreOscLFO::generateSine()
 {
-    float sample = std::sin(phase);
-    phase += phaseIncrement;
-    if (phase >= juce::MathConstants<float>::twoPi)
-        phase -= juce::MathConstants<float>::twoPi;
+    float sample = FreOscFastMath::sinPhase(phase, trigPrecision);
+    advancePhase();
     return sample;
 }
 
 float FreOscLFO::generateTriangle()
 {
+    const float t = FreOscFastMath::phaseToCycles(phase);
     float sample;
-    if (phase < juce::MathConstants<float>::pi)
-        sample = juce::jmap(phase, 0.0f, juce::MathConstants<float>::pi, -1.0f, 1.0f);
+    if (t < 0.5f)
+        sample = juce::jmap(t, 0.0f, 0.5f, -1.0f, 1.0f);
     else
-        sample = juce::jmap(phase, juce::MathConstants<float>::pi, juce::MathConstants<float>::twoPi, 1.0f, -1.0f);
+        sample = juce::jmap(t, 0.5f, 1.0f, 1.0f, -1.0f);
 
-    phase += phaseIncrement;
-    if (phase >= juce::MathConstants<float>::twoPi)
-        phase -= juce::MathConstants<float>::twoPi;
+    advancePhase();
     return sample;
 }
 
 float FreOscLFO::generateSawtooth()
 {
-    float sample = juce::jmap(phase, 0.0f, juce::MathConstants<float>::twoPi, -1.0f, 1.0f);
-    phase += phaseIncrement;
-    if (phase >= juce::MathConstants<float>::twoPi)
-        phase -= juce::MathConstants<float>::twoPi;
+    float sample = juce::jmap(FreOscFastMath::phaseToCycles(phase), 0.0f, 1.0f, -1.0f, 1.0f);
+    advancePhase();
     return sample;
 }
 
 float FreOscLFO::generateSquare()
 {
-    float sample = (phase < juce::MathConstants<float>::pi) ? -1.0f : 1.0f;
-    phase += phaseIncrement;
-    if (phase >= juce::MathConstants<float>::twoPi)
-        phase -= juce::MathConstants<float>::twoPi;
+    // Top bit set = second half of the cycle
+    float sample = (phase & 0x80000000u) == 0 ? -1.0f : 1.0f;
+    advancePhase();
     return sample;
 }
 
@@ -188,15 +152,18 @@ float FreOscLFO::generateRandom()
         samplesSinceLastRandom = 0;
     }
 
-    samplesSinceLastRandom++;
+    samplesSinceLastRandom += samplesPerStep;
     return randomValue;
 }
 
 //==============================================================================
+void FreOscLFO::advancePhase()
+{
+    // Wraps by overflow
+    phase += phaseIncrement * static_cast<FreOscFastMath::Phase>(samplesPerStep);
+}
+
 void FreOscLFO::updatePhaseIncrement()
 {
-    if (sampleRate > 0.0)
-        phaseIncrement = static_cast<float>(juce::MathConstants<double>::twoPi * rate / sampleRate);
-    else
-        phaseIncrement = 0.0f;
+    phaseIncrement = FreOscFastMath::phaseIncrementForFrequency(rate, sampleRate);
 }
\ No newline at end of file
@@ -2,6 +2,7 @@
 
 #include <juce_audio_basics/juce_audio_basics.h>
 #include <juce_dsp/juce_dsp.h>
+#include "FreOscFastMath.h"
 
 //==============================================================================
 /**
@@ -53,10 +54,11 @@ public:
     void setRate(float rateHz);          // 0.01 to 20 Hz
     void setTarget(Target target);
     void setAmount(float amount);        // 0.0 to 1.0
+    void setTrigPrecision(FreOscFastMath::Precision precision);
 
     //==============================================================================
     // Processing
-    float getNextSample(Waveform waveform, float rate, Target target);
+    float getNextSample(Waveform waveform, float rate, Target target, int numSamplesToAdvance = 1); // >1 for control-rate use
 
     //==============================================================================
     // State queries
@@ -78,13 +80,11 @@ private:
     Target currentTarget = Target::None;
     float rate = 2.0f;          // Hz
     float amount = 0.0f;        // 0.0 to 1.0
+    FreOscFastMath::Precision trigPrecision = FreOscFastMath::Precision::Polynomial;
 
     // Audio processing
     double sampleRate = 44100.0;
 
-    // Oscillator state
-    juce::dsp::Oscillator<float> oscillator;
-
     // Random LFO (sample and hold)
     juce::Random random;
     float randomValue = 0.0f;
@@ -92,8 +92,9 @@ private:
     int samplesPerRandomStep = 0;
 
     // Phase tracking for manual waveform generation
-    float phase = 0.0f;
-    float phaseIncrement = 0.0f;
+    FreOscFastMath::Phase phase = 0;            // Normalised, 2^32 per cycle
+    FreOscFastMath::Phase phaseIncrement = 0;
+    int samplesPerStep = 1; // Samples advanced per getNextSample call
 
     //==============================================================================
     // Waveform generation methods
@@ -103,6 +104,7 @@ private:
     float generateSquare();
     float generateRandom();
 
+    void advancePhase();
     void updatePhaseIncrement();
 
     //==============================================================================
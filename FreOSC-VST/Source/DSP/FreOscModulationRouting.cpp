@@ -0,0 +1,82 @@
+#include "FreOscModulationRouting.h"
+
+//==============================================================================
+void FreOscModulationRouting::compile(const int lfoTargets[3], const float lfoAmounts[3],
+                                      const int modEnvTargets[2], const float modEnvAmounts[2])
+{
+    numRoutes = 0;
+    sourceMask = 0;
+    destinationMask = 0;
+
+    // Mod envelope routes go first - they clamp before the LFOs are added on top
+    // ModEnv targets: 0=None, 1=PM Index, 2=PM Ratio, 3=Filter Cutoff, 4=Filter2 Cutoff
+    for (int i = 0; i < 2; ++i)
+    {
+        if (modEnvAmounts[i] <= 0.0f)
+            continue;
+
+        auto source = static_cast<Source>(ModEnv1 + i);
+
+        switch (modEnvTargets[i])
+        {
+            case 1: addRoute(source, PMIndex, 5.0f * modEnvAmounts[i], true); break;
+            case 2: addRoute(source, PMRatio, 4.0f * modEnvAmounts[i], true); break;
+            case 3: addRoute(source, Cutoff,  1.0f * modEnvAmounts[i], true); break;
+            case 4: addRoute(source, Cutoff2, 1.0f * modEnvAmounts[i], true); break;
+            default: break;
+        }
+    }
+
+    // LFO targets: 0=None, 1=Pitch, 2=Filter, 3=Filter2, 4=Volume, 5=Pan, 6=PM Index, 7=PM Ratio
+    for (int i = 0; i < 3; ++i)
+    {
+        if (lfoAmounts[i] <= 0.0f)
+            continue;
+
+        auto source = static_cast<Source>(LFO1 + i);
+
+        switch (lfoTargets[i])
+        {
+            case 1: addRoute(source, Pitch,   0.1f * lfoAmounts[i], false); break; // 10% of fundamental
+            case 2: addRoute(source, Cutoff,  0.3f * lfoAmounts[i], false); break; // ±30% range
+            case 3: addRoute(source, Cutoff2, 0.3f * lfoAmounts[i], false); break; // ±30% range
+            case 4: addRoute(source, Volume,  0.5f * lfoAmounts[i], false); break;
+            case 5: addRoute(source, Pan,     1.0f * lfoAmounts[i], false); break;
+            case 6: addRoute(source, PMIndex, 5.0f * lfoAmounts[i], false); break;
+            case 7: addRoute(source, PMRatio, 4.0f * lfoAmounts[i], false); break;
+            default: break;
+        }
+    }
+}
+
+//==============================================================================
+float FreOscModulationRouting::clampDestination(Destination destination, float value)
+{
+    switch (destination)
+    {
+        case Cutoff:
+        case Cutoff2:  return juce::jlimit(0.0f, 1.0f, value);
+        case Volume:   return juce::jmax(0.0f, value); // Prevent negative volume
+        case PMIndex:  return juce::jlimit(0.0f, 10.0f, value);
+        case PMRatio:  return juce::jlimit(0.1f, 8.0f, value);
+        case Pitch:
+        case Pan:
+        case NumDestinations:
+        default:       return value;
+    }
+}
+
+//==============================================================================
+void FreOscModulationRouting::addRoute(Source source, Destination destination, float scale, bool clampAfter)
+{
+    jassert(numRoutes < maxRoutes);
+
+    auto& route = routes[static_cast<size_t>(numRoutes++)];
+    route.source = source;
+    route.destination = destination;
+    route.scale = scale;
+    route.clampAfter = clampAfter;
+
+    sourceMask |= (1u << source);
+    destinationMask |= (1u << destination);
+}
@@ -0,0 +1,81 @@
+#pragma once
+
+#include <juce_core/juce_core.h>
+#include <array>
+
+//==============================================================================
+/**
+    FreOSC Modulation Routing Table
+
+    Compiles the LFO and modulation envelope target assignments into a compact
+    list of active routes (source, destination, scale). The voice walks only
+    the active routes at control rate instead of testing every source/target
+    combination.
+
+    The table is rebuilt whenever a target or amount changes; the source
+    amount is folded into each route's scale. It is a plain value type so it
+    can be copied around as part of the voice parameter snapshot.
+*/
+class FreOscModulationRouting
+{
+public:
+    //==============================================================================
+    enum Source
+    {
+        LFO1 = 0,
+        LFO2,
+        LFO3,
+        ModEnv1,
+        ModEnv2,
+        NumSources
+    };
+
+    enum Destination
+    {
+        Pitch = 0,      // Fraction of fundamental frequency
+        Cutoff,         // Filter 1 normalized cutoff
+        Cutoff2,        // Filter 2 normalized cutoff
+        Volume,         // Multiplicative: volume *= 1 + value
+        Pan,            // Added to the oscillator pan position
+        PMIndex,        // Added to PM index
+        PMRatio,        // Added to PM ratio
+        NumDestinations
+    };
+
+    struct Route
+    {
+        Source source = LFO1;
+        Destination destination = Pitch;
+        float scale = 0.0f;         // Destination scale * source amount
+        bool clampAfter = false;    // Clamp the destination right after this route
+    };
+
+    // Each source drives at most one destination
+    static constexpr int maxRoutes = NumSources;
+
+    //==============================================================================
+    FreOscModulationRouting() = default;
+
+    // Rebuild the table. Targets use the parameter choice indices (0 = None).
+    void compile(const int lfoTargets[3], const float lfoAmounts[3],
+                 const int modEnvTargets[2], const float modEnvAmounts[2]);
+
+    //==============================================================================
+    int getNumRoutes() const { return numRoutes; }
+    const Route& getRoute(int index) const { return routes[static_cast<size_t>(index)]; }
+
+    bool isSourceUsed(Source source) const { return (sourceMask & (1u << source)) != 0; }
+    bool isDestinationModulated(Destination destination) const { return (destinationMask & (1u << destination)) != 0; }
+
+    // Keep a destination value inside its valid range (pitch and pan are left unbounded)
+    static float clampDestination(Destination destination, float value);
+
+private:
+    //==============================================================================
+    std::array<Route, maxRoutes> routes;
+    int numRoutes = 0;
+    juce::uint32 sourceMask = 0;
+    juce::uint32 destinationMask = 0;
+
+    void addRoute(Source source, Destination destination, float scale, bool clampAfter);
+};
@@ -1,10 +1,11 @@
 #include "FreOscOscillator.h"
+#include "FreOscSIMDWaveforms.h"
 
 //==============================================================================
 FreOscOscillator::FreOscOscillator()
 {
-    // Initialize oscillator with sine wave by default
-    oscillator.initialise([](float x) { return std::sin(x); });
+    unisonRandom.setSeedRandomly();
+    updateUnison();
 }
 
 FreOscOscillator::~FreOscOscillator()
@@ -15,28 +16,31 @@ FreOscOscillator::~FreOscOscillator()
 void FreOscOscillator::prepare(const juce::dsp::ProcessSpec& spec)
 {
     sampleRate = spec.sampleRate;
-    oscillator.prepare(spec);
 
     // Calculate phase increment for manual phase accumulation
-    phaseIncrement = finalFrequency * 2.0f * juce::MathConstants<float>::pi / static_cast<float>(sampleRate);
+    phaseIncrement = FreOscFastMath::phaseIncrementForFrequency(finalFrequency, sampleRate);
+    updateUnison();
 
     reset();
 }
 
 void FreOscOscillator::reset()
 {
-    oscillator.reset();
-    phase = 0.0f;
+    phase = 0;
+    lastModulatedPhase = 0;
+    additiveBank.reset();
+
+    // Unison copies start at random phases so they don't sum into one loud transient
+    for (auto& group : unisonGroups)
+        for (size_t lane = 0; lane < UnisonPhaseRegister::size(); ++lane)
+            group.phase.set(lane, unisonVoices > 1 ? static_cast<FreOscFastMath::Phase>(unisonRandom.nextInt()) : 0u);
 }
 
 //==============================================================================
 void FreOscOscillator::setWaveform(Waveform waveform)
 {
-    if (currentWaveform != waveform)
-    {
-        currentWaveform = waveform;
-        updateOscillatorWaveform();
-    }
+    // Waveforms are enum-selected kernels - switching never allocates
+    currentWaveform = waveform;
 }
 
 void FreOscOscillator::setFrequency(float frequency)
@@ -47,7 +51,7 @@ void FreOscOscillator::setFrequency(float frequency)
 
 void FreOscOscillator::setLevel(float newLevel)
 {
-    level = juce::jlimit(0.0f, 0.5f, newLevel); // Decreased max level by 50%
+    level = limitLevel(newLevel);
 }
 
 void FreOscOscillator::setOctave(int octave)
@@ -67,135 +71,437 @@ void FreOscOscillator::setFrequencyModulation(float modAmount)
     frequencyModulation = modAmount;
 }
 
-//==============================================================================
-float FreOscOscillator::processSample(float fmInput)
+void FreOscOscillator::setRenderMode(RenderMode mode)
 {
-    if (level <= 0.0f)
-        return 0.0f;
+    renderMode = mode;
+}
 
-    // Calculate current phase increment including frequency modulation
-    float currentPhaseInc = phaseIncrement * (1.0f + frequencyModulation);
+void FreOscOscillator::setTrigPrecision(FreOscFastMath::Precision precision)
+{
+    trigPrecision = precision;
+}
 
-    // Advance phase
-    phase += currentPhaseInc;
+void FreOscOscillator::setAdditiveProfiles(const FreOscAdditiveProfiles* profiles)
+{
+    additiveProfiles = profiles;
+}
 
-    // Wrap main phase to prevent overflow
-    while (phase >= 2.0f * juce::MathConstants<float>::pi)
-        phase -= 2.0f * juce::MathConstants<float>::pi;
+void FreOscOscillator::setUnison(int numVoices, float detuneCents, float stereoSpread)
+{
+    numVoices = juce::jlimit(1, maxUnisonVoices, numVoices);
+    detuneCents = juce::jlimit(0.0f, 100.0f, detuneCents);
+    stereoSpread = juce::jlimit(0.0f, 1.0f, stereoSpread);
 
-    // Apply phase modulation (FM input)
-    float modulatedPhase = phase + fmInput;
+    if (numVoices == unisonVoices && detuneCents == unisonDetune && stereoSpread == unisonSpread)
+        return;
 
-    // Wrap phase to [0, 2*pi] range
-    while (modulatedPhase >= 2.0f * juce::MathConstants<float>::pi)
-        modulatedPhase -= 2.0f * juce::MathConstants<float>::pi;
-    while (modulatedPhase < 0.0f)
-        modulatedPhase += 2.0f * juce::MathConstants<float>::pi;
+    unisonVoices = numVoices;
+    unisonDetune = detuneCents;
+    unisonSpread = stereoSpread;
+    updateUnison();
+}
 
-    // Generate waveform sample
-    float sample = generateWaveformSample(modulatedPhase);
-    return sample * level;
+//==============================================================================
+float FreOscOscillator::processSample(float fmInput)
+{
+    if (level <= 0.0f)
+        return 0.0f;
+
+    return renderWaveform(advancePhase(fmInput)) * level;
 }
 
 float FreOscOscillator::processRawSample(float fmInput)
 {
     // Same processing as processSample() but returns raw waveform without level scaling
     // This is used for PM modulation where we want the waveform character but not the level
-    
     // Always process even if level is 0 - PM needs the raw waveform
-    // Calculate current phase increment including frequency modulation
-    float currentPhaseInc = phaseIncrement * (1.0f + frequencyModulation);
-    
-    // Advance phase
-    phase += currentPhaseInc;
-    
-    // Wrap main phase to prevent overflow
-    while (phase >= 2.0f * juce::MathConstants<float>::pi)
-        phase -= 2.0f * juce::MathConstants<float>::pi;
-        
-    // Apply phase modulation (FM input)
-    float modulatedPhase = phase + fmInput;
-    
-    // Wrap phase to [0, 2*pi] range
-    while (modulatedPhase >= 2.0f * juce::MathConstants<float>::pi)
-        modulatedPhase -= 2.0f * juce::MathConstants<float>::pi;
-    while (modulatedPhase < 0.0f)
-        modulatedPhase += 2.0f * juce::MathConstants<float>::pi;
-        
-    // Generate and return raw waveform sample (no level scaling)
-    return generateWaveformSample(modulatedPhase);
-}
-
-void FreOscOscillator::processBlock(juce::AudioBuffer<float>& buffer, int startSample, int numSamples, float fmInput)
+    return renderWaveform(advancePhase(fmInput));
+}
+
+void FreOscOscillator::renderBlock(float* destination, int numSamples, const float* phaseModulation, const float* pitchModulation)
 {
     if (level <= 0.0f)
         return;
 
-    // Apply FM modulation if provided
-    float currentFreq = finalFrequency;
-    if (fmInput != 0.0f)
-        currentFreq += fmInput;
-
-    oscillator.setFrequency(currentFreq);
+    if (usesAdditiveBank())
+    {
+        renderAdditive(destination, numSamples, phaseModulation, pitchModulation, level, true);
+        return;
+    }
 
-    // Process block with level scaling
-    for (int sample = 0; sample < numSamples; ++sample)
+    if (unisonVoices > 1)
     {
-        float oscillatorSample = oscillator.processSample(0.0f) * level;
+        renderUnison<false>(destination, nullptr, numSamples, phaseModulation, pitchModulation);
+        return;
+    }
 
-        // Add to both stereo channels
-        buffer.addSample(0, startSample + sample, oscillatorSample);
-        buffer.addSample(1, startSample + sample, oscillatorSample);
+    if (phaseModulation != nullptr)
+    {
+        if (pitchModulation != nullptr) renderSpan<true, true, true>(destination, numSamples, phaseModulation, pitchModulation, level);
+        else                            renderSpan<true, false, true>(destination, numSamples, phaseModulation, pitchModulation, level);
+    }
+    else
+    {
+        if (pitchModulation != nullptr) renderSpan<false, true, true>(destination, numSamples, phaseModulation, pitchModulation, level);
+        else                            renderSpan<false, false, true>(destination, numSamples, phaseModulation, pitchModulation, level);
     }
 }
 
-//==============================================================================
-void FreOscOscillator::updateFinalFrequency()
+void FreOscOscillator::renderRawBlock(float* destination, int numSamples, const float* phaseModulation, const float* pitchModulation)
 {
-    // Calculate final frequency: base * octave_multiplier * detune_ratio
-    float octaveMultiplier = octaveToMultiplier(octaveOffset);
-    float detuneRatio = centsToRatio(detuneAmount);
+    // Always rendered, like processRawSample()
+    if (usesAdditiveBank())
+    {
+        renderAdditive(destination, numSamples, phaseModulation, pitchModulation, 1.0f, false);
+        return;
+    }
 
-    finalFrequency = baseFrequency * octaveMultiplier * detuneRatio;
+    if (phaseModulation != nullptr)
+    {
+        if (pitchModulation != nullptr) renderSpan<true, true, false>(destination, numSamples, phaseModulation, pitchModulation, 1.0f);
+        else                            renderSpan<true, false, false>(destination, numSamples, phaseModulation, pitchModulation, 1.0f);
+    }
+    else
+    {
+        if (pitchModulation != nullptr) renderSpan<false, true, false>(destination, numSamples, phaseModulation, pitchModulation, 1.0f);
+        else                            renderSpan<false, false, false>(destination, numSamples, phaseModulation, pitchModulation, 1.0f);
+    }
+}
 
-    // Update the oscillator frequency
-    oscillator.setFrequency(finalFrequency);
+void FreOscOscillator::renderStereoBlock(float* midDestination, float* sideDestination, int numSamples,
+                                         const float* phaseModulation, const float* pitchModulation)
+{
+    if (level <= 0.0f)
+        return;
 
-    // Update phase increment for manual phase accumulation
-    if (sampleRate > 0.0)
-        phaseIncrement = finalFrequency * 2.0f * juce::MathConstants<float>::pi / static_cast<float>(sampleRate);
+    if (!hasStereoUnison() || sideDestination == nullptr)
+        renderBlock(midDestination, numSamples, phaseModulation, pitchModulation);
+    else
+        renderUnison<true>(midDestination, sideDestination, numSamples, phaseModulation, pitchModulation);
 }
 
-void FreOscOscillator::updateOscillatorWaveform()
+template <bool hasPhaseModulation, bool hasPitchModulation, bool addToDestination>
+void FreOscOscillator::renderSpan(float* destination, int numSamples, const float* phaseModulation,
+                                  const float* pitchModulation, float gain)
 {
-    // Set the oscillator waveform based on current selection
-    switch (currentWaveform)
+    using Phase = FreOscFastMath::Phase;
+    using Precision = FreOscFastMath::Precision;
+
+    auto run = [&](auto kernel)
     {
-        case Waveform::Sine:
-            oscillator.initialise([](float x) { return std::sin(x); });
-            break;
+        renderLoop<hasPhaseModulation, hasPitchModulation, addToDestination>(destination, numSamples, phaseModulation,
+                                                                            pitchModulation, gain, kernel);
+    };
 
-        case Waveform::Square:
-            oscillator.initialise([](float x) { return x < 0.0f ? -1.0f : 1.0f; });
+    // Resolve the waveform once so each loop body is a single inlined kernel
+    auto runForWaveform = [&](auto makeKernel)
+    {
+        switch (currentWaveform)
+        {
+            case Waveform::Square:   run(makeKernel(std::integral_constant<Waveform, Waveform::Square>())); break;
+            case Waveform::Sawtooth: run(makeKernel(std::integral_constant<Waveform, Waveform::Sawtooth>())); break;
+            case Waveform::Triangle: run(makeKernel(std::integral_constant<Waveform, Waveform::Triangle>())); break;
+            case Waveform::Sine:
+            default:                 run(makeKernel(std::integral_constant<Waveform, Waveform::Sine>())); break;
+        }
+    };
+
+    // A sine has no harmonics to band-limit in any render mode
+    if (currentWaveform == Waveform::Sine)
+    {
+        switch (trigPrecision)
+        {
+            case Precision::Polynomial: run([](Phase phaseValue, Phase) { return FreOscFastMath::sinPhase(phaseValue, Precision::Polynomial); }); break;
+            case Precision::Table:      run([](Phase phaseValue, Phase) { return FreOscFastMath::sinPhase(phaseValue, Precision::Table); }); break;
+            case Precision::Exact:
+            default:                    run([](Phase phaseValue, Phase) { return FreOscFastMath::sinPhase(phaseValue, Precision::Exact); }); break;
+        }
+        return;
+    }
+
+    switch (renderMode)
+    {
+        case RenderMode::Raw:
+            runForWaveform([](auto waveform)
+            {
+                return [](Phase phaseValue, Phase)
+                {
+                    return generateWaveform(decltype(waveform)::value, FreOscFastMath::phaseToRadians(phaseValue));
+                };
+            });
             break;
 
-        case Waveform::Sawtooth:
-            oscillator.initialise([](float x) {
-                return juce::jmap(x, -juce::MathConstants<float>::pi, juce::MathConstants<float>::pi, -1.0f, 1.0f);
+        case RenderMode::Wavetable:
+        case RenderMode::Additive:
+        {
+            const auto& table = wavetables->getTable(static_cast<int>(currentWaveform));
+            run([&table](Phase phaseValue, Phase phaseDelta)
+            {
+                const int mipLevel = FreOscWavetable::getMipLevel(FreOscFastMath::phaseDeltaToCycles(phaseDelta));
+                return table.getSample(mipLevel, FreOscFastMath::phaseToCycles(phaseValue));
             });
             break;
+        }
 
-        case Waveform::Triangle:
-            oscillator.initialise([](float x) {
-                return juce::jmap(std::abs(x), 0.0f, juce::MathConstants<float>::pi, -1.0f, 1.0f);
+        case RenderMode::PolyBLEP:
+        default:
+            runForWaveform([](auto waveform)
+            {
+                return [](Phase phaseValue, Phase phaseDelta)
+                {
+                    const float radiansPerSample = std::abs(FreOscFastMath::phaseDeltaToCycles(phaseDelta)) * juce::MathConstants<float>::twoPi;
+                    return generateBandLimitedWaveform(decltype(waveform)::value, FreOscFastMath::phaseToRadians(phaseValue), radiansPerSample);
+                };
             });
             break;
     }
 }
 
+template <bool hasPhaseModulation, bool hasPitchModulation, bool addToDestination, typename Kernel>
+void FreOscOscillator::renderLoop(float* destination, int numSamples, const float* phaseModulation,
+                                  const float* pitchModulation, float gain, Kernel kernel)
+{
+    // Work on local copies so the accumulators stay in registers
+    auto currentPhase = phase;
+    auto previousPhase = lastModulatedPhase;
+    const auto fixedIncrement = FreOscFastMath::scalePhaseIncrement(phaseIncrement, 1.0f + frequencyModulation);
+
+    for (int sample = 0; sample < numSamples; ++sample)
+    {
+        if constexpr (hasPitchModulation)
+            currentPhase += FreOscFastMath::scalePhaseIncrement(phaseIncrement, 1.0f + pitchModulation[sample]);
+        else
+            currentPhase += fixedIncrement;
+
+        auto modulatedPhase = currentPhase;
+        if constexpr (hasPhaseModulation)
+            modulatedPhase += FreOscFastMath::phaseFromRadians(phaseModulation[sample]);
+
+        const float value = kernel(modulatedPhase, modulatedPhase - previousPhase) * gain;
+        previousPhase = modulatedPhase;
+
+        if constexpr (addToDestination)
+            destination[sample] += value;
+        else
+            destination[sample] = value;
+    }
+
+    phase = currentPhase;
+    lastModulatedPhase = previousPhase;
+}
+
+//==============================================================================
+void FreOscOscillator::renderAdditive(float* destination, int numSamples, const float* phaseModulation,
+                                      const float* pitchModulation, float gain, bool addToDestination)
+{
+    float ratio = 1.0f + frequencyModulation;
+    if (pitchModulation != nullptr && numSamples > 0)
+    {
+        float total = 0.0f;
+        for (int sample = 0; sample < numSamples; ++sample)
+            total += pitchModulation[sample];
+
+        ratio = 1.0f + total / static_cast<float>(numSamples);
+    }
+
+    // The phase accumulator keeps running so the other render modes pick up in tune
+    const auto increment = FreOscFastMath::scalePhaseIncrement(phaseIncrement, ratio);
+    phase += increment * static_cast<FreOscFastMath::Phase>(numSamples);
+    lastModulatedPhase = phase;
+
+    const double cyclesPerSample = static_cast<double>(finalFrequency) * static_cast<double>(ratio) / sampleRate;
+    additiveBank.render(additiveProfiles->getProfile(static_cast<int>(currentWaveform)), destination, numSamples,
+                        cyclesPerSample, phaseModulation, gain, addToDestination, trigPrecision);
+}
+
+//==============================================================================
+void FreOscOscillator::updateUnison()
+{
+    // Copies are spread evenly across the detune width and the stereo field
+    const float gain = 1.0f / std::sqrt(static_cast<float>(unisonVoices));
+
+    for (int voice = 0; voice < maxUnisonVoices; ++voice)
+    {
+        auto& group = unisonGroups[voice / unisonLanes];
+        const auto lane = static_cast<size_t>(voice % unisonLanes);
+
+        const bool active = voice < unisonVoices;
+        const float position = unisonVoices > 1 ? 2.0f * static_cast<float>(voice) / static_cast<float>(unisonVoices - 1) - 1.0f : 0.0f;
+        const float frequency = finalFrequency * centsToRatio(0.5f * unisonDetune * position);
+
+        group.phaseIncrement.set(lane, FreOscFastMath::phaseIncrementForFrequency(frequency, sampleRate));
+
+        // Same limits as generateBandLimitedWaveform()
+        const float dt = juce::jlimit(1.0e-6f, 0.5f, frequency / static_cast<float>(sampleRate));
+        group.cyclesPerSample.set(lane, dt);
+        group.samplesPerCycle.set(lane, 1.0f / dt);
+
+        group.midGain.set(lane, active ? gain : 0.0f);
+        group.sideGain.set(lane, active ? gain * position * unisonSpread : 0.0f);
+    }
+}
+
+template <bool hasSide>
+void FreOscOscillator::renderUnison(float* midDestination, float* sideDestination, int numSamples,
+                                    const float* phaseModulation, const float* pitchModulation)
+{
+    if (phaseModulation != nullptr)
+    {
+        if (pitchModulation != nullptr) renderUnisonSpan<true, true, hasSide>(midDestination, sideDestination, numSamples, phaseModulation, pitchModulation);
+        else                            renderUnisonSpan<true, false, hasSide>(midDestination, sideDestination, numSamples, phaseModulation, pitchModulation);
+    }
+    else
+    {
+        if (pitchModulation != nullptr) renderUnisonSpan<false, true, hasSide>(midDestination, sideDestination, numSamples, phaseModulation, pitchModulation);
+        else                            renderUnisonSpan<false, false, hasSide>(midDestination, sideDestination, numSamples, phaseModulation, pitchModulation);
+    }
+}
+
+template <bool hasPhaseModulation, bool hasPitchModulation, bool hasSide>
+void FreOscOscillator::renderUnisonSpan(float* midDestination, float* sideDestination, int numSamples,
+                                        const float* phaseModulation, const float* pitchModulation)
+{
+    const bool usesTable = renderMode == RenderMode::Wavetable || renderMode == RenderMode::Additive;
+    const auto* table = usesTable ? &wavetables->getTable(static_cast<int>(currentWaveform)) : nullptr;
+
+    // Resolve the waveform once so each loop body is a single inlined kernel
+    FreOscSIMDWaveforms::dispatchKernel(currentWaveform, renderMode, trigPrecision, table, [&](auto kernel)
+    {
+        renderUnisonLoop<hasPhaseModulation, hasPitchModulation, hasSide>(midDestination, sideDestination, numSamples,
+                                                                         phaseModulation, pitchModulation, kernel);
+    });
+}
+
+template <bool hasPhaseModulation, bool hasPitchModulation, bool hasSide, typename Kernel>
+void FreOscOscillator::renderUnisonLoop(float* midDestination, float* sideDestination, int numSamples,
+                                        const float* phaseModulation, const float* pitchModulation, Kernel kernel)
+{
+    const int numGroups = (unisonVoices + unisonLanes - 1) / unisonLanes;
+    const float fixedRatio = 1.0f + frequencyModulation;
+
+    // Unmodulated increments, scaled once for the block
+    UnisonPhaseRegister fixedIncrements[maxUnisonGroups];
+    for (int groupIndex = 0; groupIndex < numGroups; ++groupIndex)
+    {
+        const auto& increment = unisonGroups[groupIndex].phaseIncrement;
+        for (size_t lane = 0; lane < UnisonPhaseRegister::size(); ++lane)
+            fixedIncrements[groupIndex].set(lane, FreOscFastMath::scalePhaseIncrement(increment.get(lane), fixedRatio));
+    }
+
+    for (int sample = 0; sample < numSamples; ++sample)
+    {
+        const float ratio = hasPitchModulation ? 1.0f + pitchModulation[sample] : fixedRatio;
+        const float inverseRatio = 1.0f / juce::jmax(1.0e-3f, ratio);
+
+        UnisonPhaseRegister phaseOffset = UnisonPhaseRegister::expand(0u);
+        if constexpr (hasPhaseModulation)
+            phaseOffset = UnisonPhaseRegister::expand(FreOscFastMath::phaseFromRadians(phaseModulation[sample]));
+
+        auto midSum = UnisonRegister::expand(0.0f);
+        auto sideSum = UnisonRegister::expand(0.0f);
+
+        for (int groupIndex = 0; groupIndex < numGroups; ++groupIndex)
+        {
+            auto& group = unisonGroups[groupIndex];
+
+            if constexpr (hasPitchModulation)
+            {
+                // No float multiply for integer lanes - scale the increments lane by lane
+                UnisonPhaseRegister increment;
+                for (size_t lane = 0; lane < UnisonPhaseRegister::size(); ++lane)
+                    increment.set(lane, FreOscFastMath::scalePhaseIncrement(group.phaseIncrement.get(lane), ratio));
+                group.phase += increment;
+            }
+            else
+            {
+                group.phase += fixedIncrements[groupIndex];
+            }
+
+            const auto dt = UnisonRegister::min(group.cyclesPerSample * ratio, UnisonRegister::expand(0.5f));
+            const auto inverseDt = UnisonRegister::max(group.samplesPerCycle * inverseRatio, UnisonRegister::expand(2.0f));
+            const auto value = kernel(group.phase + phaseOffset, dt, inverseDt);
+
+            midSum += value * group.midGain;
+            if constexpr (hasSide)
+                sideSum += value * group.sideGain;
+        }
+
+        midDestination[sample] += midSum.sum() * level;
+        if constexpr (hasSide)
+            sideDestination[sample] += sideSum.sum() * level;
+    }
+}
+
+//==============================================================================
+void FreOscOscillator::updateFinalFrequency()
+{
+    finalFrequency = calculateFrequency(baseFrequency, octaveOffset, detuneAmount);
+
+    // Update phase increment for manual phase accumulation
+    phaseIncrement = FreOscFastMath::phaseIncrementForFrequency(finalFrequency, sampleRate);
+
+    // Unison lanes are only retuned while in use (setUnison() catches up)
+    if (unisonVoices > 1)
+        updateUnison();
+}
+
 float FreOscOscillator::generateWaveformSample(float phaseValue) const
 {
-    switch (currentWaveform)
+    return generateWaveform(currentWaveform, phaseValue);
+}
+
+FreOscFastMath::Phase FreOscOscillator::advancePhase(float fmInput)
+{
+    // Frequency modulation scales the increment; the accumulator wraps by overflow
+    phase += FreOscFastMath::scalePhaseIncrement(phaseIncrement, 1.0f + frequencyModulation);
+
+    // Apply phase modulation (radians) on top of the running phase
+    return phase + FreOscFastMath::phaseFromRadians(fmInput);
+}
+
+float FreOscOscillator::renderWaveform(FreOscFastMath::Phase modulatedPhase)
+{
+    // Actual phase advance of this sample (includes FM and PM) - the signed
+    // difference of two accumulators is already wrapped to half a cycle
+    const float cyclesPerSample = FreOscFastMath::phaseDeltaToCycles(modulatedPhase - lastModulatedPhase);
+    lastModulatedPhase = modulatedPhase;
+
+    // A sine has no harmonics to band-limit in any render mode
+    if (currentWaveform == Waveform::Sine)
+        return FreOscFastMath::sinPhase(modulatedPhase, trigPrecision);
+
+    if (renderMode == RenderMode::Raw)
+        return generateWaveformSample(FreOscFastMath::phaseToRadians(modulatedPhase));
+
+    if (renderMode == RenderMode::Wavetable || renderMode == RenderMode::Additive)
+    {
+        // One interpolated read from the mip level that fits this phase increment
+        const int mipLevel = FreOscWavetable::getMipLevel(cyclesPerSample);
+        return wavetables->getTable(static_cast<int>(currentWaveform)).getSample(mipLevel, FreOscFastMath::phaseToCycles(modulatedPhase));
+    }
+
+    return generateBandLimitedWaveform(currentWaveform, FreOscFastMath::phaseToRadians(modulatedPhase),
+                                       std::abs(cyclesPerSample) * juce::MathConstants<float>::twoPi);
+}
+
+//==============================================================================
+float FreOscOscillator::calculateFrequency(float baseFrequency, int octave, float cents)
+{
+    // Calculate final frequency: base * octave_multiplier * detune_ratio
+    float octaveMultiplier = octaveToMultiplier(juce::jlimit(-2, 2, octave));
+    float detuneRatio = centsToRatio(juce::jlimit(-50.0f, 50.0f, cents));
+
+    return baseFrequency * octaveMultiplier * detuneRatio;
+}
+
+float FreOscOscillator::limitLevel(float newLevel)
+{
+    return juce::jlimit(0.0f, 0.5f, newLevel); // Decreased max level by 50%
+}
+
+float FreOscOscillator::generateWaveform(Waveform waveform, float phaseValue)
+{
+    switch (waveform)
     {
         case Waveform::Sine:
             return std::sin(phaseValue);
@@ -215,4 +521,72 @@ float FreOscOscillator::generateWaveformSample(float phaseValue) const
         default:
             return 0.0f;
     }
-}
\ No newline at end of file
+}
+float FreOscOscillator::generateBandLimitedWaveform(Waveform waveform, float phaseValue, float phaseDelta)
+{
+    // Work in cycles: t in [0, 1), dt = cycles per sample (at most half a cycle)
+    const float t = phaseValue / (2.0f * juce::MathConstants<float>::pi);
+    const float dt = juce::jlimit(1.0e-6f, 0.5f, phaseDelta / (2.0f * juce::MathConstants<float>::pi));
+
+    float halfCycle = t + 0.5f;
+    if (halfCycle >= 1.0f)
+        halfCycle -= 1.0f;
+
+    switch (waveform)
+    {
+        case Waveform::Sine:
+            return std::sin(phaseValue);
+
+        case Waveform::Square:
+            // Step up at t = 0, step down at t = 0.5
+            return generateWaveform(waveform, phaseValue) + polyBlep(t, dt) - polyBlep(halfCycle, dt);
+
+        case Waveform::Sawtooth:
+            // Step down at the wrap
+            return generateWaveform(waveform, phaseValue) - polyBlep(t, dt);
+
+        case Waveform::Triangle:
+            // Slope changes by 8 per cycle at t = 0 (minimum) and t = 0.5 (maximum)
+            return generateWaveform(waveform, phaseValue) + 4.0f * dt * (polyBlamp(t, dt) - polyBlamp(halfCycle, dt));
+
+        default:
+            return 0.0f;
+    }
+}
+
+float FreOscOscillator::polyBlep(float t, float dt)
+{
+    // Just after the discontinuity
+    if (t < dt)
+    {
+        t /= dt;
+        return t + t - t * t - 1.0f;
+    }
+
+    // Just before the discontinuity
+    if (t > 1.0f - dt)
+    {
+        t = (t - 1.0f) / dt;
+        return t * t + t + t + 1.0f;
+    }
+
+    return 0.0f;
+}
+
+float FreOscOscillator::polyBlamp(float t, float dt)
+{
+    // Integrated polyBlep, for discontinuities in the first derivative
+    if (t < dt)
+    {
+        t = t / dt - 1.0f;
+        return -t * t * t / 3.0f;
+    }
+
+    if (t > 1.0f - dt)
+    {
+        t = (t - 1.0f) / dt + 1.0f;
+        return t * t * t / 3.0f;
+    }
+
+    return 0.0f;
+}
@@ -2,17 +2,22 @@
 
 #include <juce_audio_basics/juce_audio_basics.h>
 #include <juce_dsp/juce_dsp.h>
+#include "FreOscWavetable.h"
+#include "FreOscFastMath.h"
+#include "FreOscAdditive.h"
 
 //==============================================================================
 /**
     FreOSC Oscillator Class
 
-    Wraps JUCE's DSP oscillator with additional functionality:
+    Phase accumulator oscillator with:
     - Multiple waveforms (Sine, Square, Sawtooth, Triangle)
     - Octave shifting
     - Fine detuning in cents
     - Level control
     - FM modulation support
+    - Raw, band-limited (PolyBLEP/PolyBLAMP), mipmapped wavetable or additive rendering
+    - Unison: up to 8 detuned, stereo spread copies rendered as SIMD lanes
 */
 class FreOscOscillator
 {
@@ -27,6 +32,15 @@ public:
         Triangle = 3
     };
 
+    // How non-sine waveforms are rendered
+    enum class RenderMode
+    {
+        Raw = 0,        // Naive waveforms straight from the phase (aliases at high pitches)
+        PolyBLEP = 1,   // PolyBLEP at saw/square steps, PolyBLAMP at triangle corners
+        Wavetable = 2,  // Shared band-limited mip tables (FreOscWavetableLibrary)
+        Additive = 3    // Up to 256 partials from a spectral profile (FreOscAdditiveBank)
+    };
+
     //==============================================================================
     FreOscOscillator();
     ~FreOscOscillator();
@@ -44,27 +58,61 @@ public:
     void setOctave(int octave); // -2 to +2
     void setDetune(float cents); // -50 to +50 cents
     void setFrequencyModulation(float modAmount); // Real-time frequency modulation
+    void setRenderMode(RenderMode mode);
+    void setTrigPrecision(FreOscFastMath::Precision precision); // Sine kernel
+
+    // Spectral profiles for the additive render mode (owned by the processor). Without
+    // them, and in the per-sample API, additive oscillators play the wavetables instead.
+    void setAdditiveProfiles(const FreOscAdditiveProfiles* profiles);
+
+    // Unison copies share every other setting of this oscillator. detuneCents is the
+    // total width, stereoSpread (0 to 1) spreads the copies from left to right.
+    // Additive oscillators ignore unison.
+    static constexpr int maxUnisonVoices = 8;
+    void setUnison(int numVoices, float detuneCents, float stereoSpread);
 
     //==============================================================================
     // Processing
     float processSample(float fmInput = 0.0f);
     float processRawSample(float fmInput = 0.0f); // Raw waveform without level scaling (for PM)
-    void processBlock(juce::AudioBuffer<float>& buffer, int startSample, int numSamples, float fmInput = 0.0f);
+
+    // Block rendering. phaseModulation (radians) and pitchModulation (fraction of the
+    // frequency, replaces setFrequencyModulation()) are optional per-sample buffers.
+    void renderBlock(float* destination, int numSamples,
+                     const float* phaseModulation = nullptr, const float* pitchModulation = nullptr);    // Adds level-scaled output
+    void renderRawBlock(float* destination, int numSamples,
+                        const float* phaseModulation = nullptr, const float* pitchModulation = nullptr); // Writes the raw waveform
+
+    // Like renderBlock(), but stereo spread unison adds its side signal (right minus left, halved)
+    void renderStereoBlock(float* midDestination, float* sideDestination, int numSamples,
+                           const float* phaseModulation = nullptr, const float* pitchModulation = nullptr);
 
     //==============================================================================
     // State queries
     bool isActive() const { return level > 0.0f; }
     float getCurrentLevel() const { return level; }
     float getCurrentFrequency() const { return finalFrequency; }
+    float getBaseFrequency() const { return baseFrequency; }
     Waveform getCurrentWaveform() const { return currentWaveform; }
     int getCurrentOctave() const { return octaveOffset; }
     float getCurrentDetune() const { return detuneAmount; }
+    RenderMode getCurrentRenderMode() const { return renderMode; }
+    int getUnisonVoices() const { return unisonVoices; }
+    bool hasStereoUnison() const { return unisonVoices > 1 && unisonSpread > 0.0f && !usesAdditiveBank(); }
 
-private:
     //==============================================================================
-    // Internal oscillator
-    juce::dsp::Oscillator<float> oscillator;
+    // Shared maths (also used by engines that keep oscillator state elsewhere)
+    static float calculateFrequency(float baseFrequency, int octave, float cents);
+    static float limitLevel(float level);
+    static float generateWaveform(Waveform waveform, float phaseValue); // phaseValue in [0, 2*pi)
+    static float generateBandLimitedWaveform(Waveform waveform, float phaseValue, float phaseDelta); // phaseDelta = radians per sample
+
+    // Polynomial band-limited step / ramp residuals (t = phase in cycles, dt = cycles per sample)
+    static float polyBlep(float t, float dt);
+    static float polyBlamp(float t, float dt);
 
+private:
+    //==============================================================================
     // Parameter state
     Waveform currentWaveform = Waveform::Sine;
     float baseFrequency = 440.0f;
@@ -73,19 +121,78 @@ private:
     int octaveOffset = 0;
     float detuneAmount = 0.0f;
     float frequencyModulation = 0.0f;
+    RenderMode renderMode = RenderMode::Raw;
+    FreOscFastMath::Precision trigPrecision = FreOscFastMath::Precision::Polynomial;
+
+    // Built-in wavetables, shared by all oscillators
+    juce::SharedResourcePointer<FreOscWavetableLibrary> wavetables;
+
+    // Additive partials (the profiles are shared by all oscillators)
+    const FreOscAdditiveProfiles* additiveProfiles = nullptr;
+    FreOscAdditiveBank additiveBank;
 
     // Audio processing
     double sampleRate = 44100.0;
 
-    // Phase accumulator for FM synthesis
-    float phase = 0.0f;
-    float phaseIncrement = 0.0f;
+    // Normalised phase accumulator (2^32 per cycle, wraps by overflow)
+    FreOscFastMath::Phase phase = 0;
+    FreOscFastMath::Phase phaseIncrement = 0;
+    FreOscFastMath::Phase lastModulatedPhase = 0; // Gives the per-sample phase advance including PM
+
+    // Unison lanes, packed into SIMD registers
+    using UnisonRegister = juce::dsp::SIMDRegister<float>;
+    using UnisonPhaseRegister = juce::dsp::SIMDRegister<FreOscFastMath::Phase>;
+    static constexpr int unisonLanes = static_cast<int>(UnisonRegister::SIMDNumElements);
+    static constexpr int maxUnisonGroups = (maxUnisonVoices + unisonLanes - 1) / unisonLanes;
+
+    struct UnisonGroup
+    {
+        UnisonPhaseRegister phase;
+        UnisonPhaseRegister phaseIncrement;
+        UnisonRegister cyclesPerSample;     // Nominal PolyBLEP dt and 1/dt
+        UnisonRegister samplesPerCycle;
+        UnisonRegister midGain;             // Zero for unused lanes
+        UnisonRegister sideGain;
+    };
+
+    UnisonGroup unisonGroups[maxUnisonGroups];
+    int unisonVoices = 1;
+    float unisonDetune = 0.0f;
+    float unisonSpread = 0.0f;
+    juce::Random unisonRandom;              // Start phases
 
     //==============================================================================
     // Helper methods
     void updateFinalFrequency();
-    void updateOscillatorWaveform();
     float generateWaveformSample(float phaseValue) const;
+    FreOscFastMath::Phase advancePhase(float fmInput);
+    float renderWaveform(FreOscFastMath::Phase modulatedPhase);
+
+    // Block renderer, specialised on the modulation inputs and then on the waveform kernel
+    template <bool hasPhaseModulation, bool hasPitchModulation, bool addToDestination>
+    void renderSpan(float* destination, int numSamples, const float* phaseModulation, const float* pitchModulation, float gain);
+
+    template <bool hasPhaseModulation, bool hasPitchModulation, bool addToDestination, typename Kernel>
+    void renderLoop(float* destination, int numSamples, const float* phaseModulation, const float* pitchModulation,
+                    float gain, Kernel kernel);
+
+    // Additive renderer - pitch modulation retunes the partials once per call, at its mean
+    bool usesAdditiveBank() const;
+    void renderAdditive(float* destination, int numSamples, const float* phaseModulation,
+                        const float* pitchModulation, float gain, bool addToDestination);
+
+    // Unison renderer (adds into mid, and side when given)
+    void updateUnison();
+    template <bool hasSide>
+    void renderUnison(float* midDestination, float* sideDestination, int numSamples,
+                      const float* phaseModulation, const float* pitchModulation);
+    template <bool hasPhaseModulation, bool hasPitchModulation, bool hasSide>
+    void renderUnisonSpan(float* midDestination, float* sideDestination, int numSamples,
+                          const float* phaseModulation, const float* pitchModulation);
+
+    template <bool hasPhaseModulation, bool hasPitchModulation, bool hasSide, typename Kernel>
+    void renderUnisonLoop(float* midDestination, float* sideDestination, int numSamples,
+                          const float* phaseModulation, const float* pitchModulation, Kernel kernel);
 
     // Frequency calculation helpers
     static float centsToRatio(float cents);
@@ -104,6 +211,12 @@ inline float FreOscOscillator::centsToRatio(float cents)
     return std::pow(2.0f, cents / 1200.0f);
 }
 
+inline bool FreOscOscillator::usesAdditiveBank() const
+{
+    // A sine has no partials to add, so it keeps the plain sine kernel
+    return renderMode == RenderMode::Additive && additiveProfiles != nullptr && currentWaveform != Waveform::Sine;
+}
+
 inline float FreOscOscillator::octaveToMultiplier(int octave)
 {
     // Convert octave offset to frequency multiplier: multiplier = 2^octave
@@ -0,0 +1,246 @@
+#include "FreOscParallelVoiceRenderer.h"
+#include <thread>
+
+//==============================================================================
+class FreOscParallelVoiceRenderer::Worker : public juce::Thread
+{
+public:
+    Worker(FreOscParallelVoiceRenderer& rendererToUse, int chunkToRender)
+        : juce::Thread("FreOSC Voice Worker " + juce::String(chunkToRender)),
+          renderer(rendererToUse), chunkIndex(chunkToRender)
+    {
+    }
+
+    // Called by the audio thread once the job has been set up
+    void dispatch()
+    {
+        requestedJob.fetch_add(1);
+
+        if (sleeping.load())
+            wakeEvent.signal();
+    }
+
+    void stop()
+    {
+        signalThreadShouldExit();
+        wakeEvent.signal();
+        stopThread(1000);
+    }
+
+    void run() override
+    {
+        while (!threadShouldExit())
+        {
+            if (!waitForJob())
+                continue;
+
+            juce::ScopedNoDenormals noDenormals;
+            renderer.renderChunk(chunkIndex);
+            renderer.pendingChunks.fetch_sub(1, std::memory_order_acq_rel);
+        }
+    }
+
+private:
+    FreOscParallelVoiceRenderer& renderer;
+    const int chunkIndex;
+
+    std::atomic<juce::uint32> requestedJob { 0 };
+    juce::uint32 completedJob = 0;
+    std::atomic<bool> sleeping { false };
+    juce::WaitableEvent wakeEvent;
+
+    // Spinning workers park on the event after this many empty checks, so an
+    // idle plugin does not keep cores busy
+    static constexpr int maxSpinIterations = 20000;
+
+    bool waitForJob()
+    {
+        for (int iterations = 0; !threadShouldExit(); ++iterations)
+        {
+            const auto job = requestedJob.load();
+            if (job != completedJob)
+            {
+                completedJob = job;
+                return true;
+            }
+
+            const auto strategy = static_cast<WaitStrategy>(renderer.waitStrategy.load(std::memory_order_relaxed));
+
+            if (strategy == WaitStrategy::Block || iterations >= maxSpinIterations)
+            {
+                // Re-check after announcing the sleep so a dispatch can't be missed
+                sleeping.store(true);
+                if (requestedJob.load() == completedJob)
+                    wakeEvent.wait(100.0);
+                sleeping.store(false);
+                iterations = 0;
+            }
+            else if (strategy == WaitStrategy::Yield)
+            {
+                std::this_thread::yield();
+            }
+        }
+
+        return false;
+    }
+
+    JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR(Worker)
+};
+
+//==============================================================================
+FreOscParallelVoiceRenderer::FreOscParallelVoiceRenderer()
+{
+}
+
+FreOscParallelVoiceRenderer::~FreOscParallelVoiceRenderer()
+{
+    release();
+}
+
+//==============================================================================
+void FreOscParallelVoiceRenderer::prepare(double sampleRate, int maximumBlockSize, int maximumVoices)
+{
+    release();
+
+    workerBlockSize = maximumBlockSize;
+    workerOptions = juce::Thread::RealtimeOptions{}.withApproximateAudioProcessingTime(maximumBlockSize, sampleRate);
+
+    chunkBuffers[0].setSize(2, maximumBlockSize);
+    activeVoices.ensureStorageAllocated(maximumVoices);
+
+    // Start the workers the current setting asks for now, then follow it
+    timerCallback();
+    startTimerHz(10);
+}
+
+void FreOscParallelVoiceRenderer::release()
+{
+    stopTimer();
+    stopWorkers(0);
+}
+
+void FreOscParallelVoiceRenderer::setNumThreads(int numThreads)
+{
+    requestedThreads.store(juce::jlimit(1, maxThreads, numThreads), std::memory_order_relaxed);
+}
+
+//==============================================================================
+void FreOscParallelVoiceRenderer::timerCallback()
+{
+    // One worker per extra thread, at most one per spare core
+    const int wantedWorkers = juce::jlimit(0, maxThreads - 1, juce::jmin(requestedThreads.load(std::memory_order_relaxed),
+                                                                          juce::SystemStats::getNumCpus()) - 1);
+    const int runningWorkers = availableWorkers.load();
+
+    if (wantedWorkers > runningWorkers)
+        startWorkers(wantedWorkers);
+    else if (wantedWorkers < runningWorkers)
+        stopWorkers(wantedWorkers);
+}
+
+void FreOscParallelVoiceRenderer::startWorkers(int numWorkers)
+{
+    for (int index = availableWorkers.load(); index < numWorkers; ++index)
+    {
+        chunkBuffers[index + 1].setSize(2, workerBlockSize);
+
+        workers[index] = std::make_unique<Worker>(*this, index + 1);
+        if (!workers[index]->startRealtimeThread(workerOptions))
+            workers[index]->startThread(juce::Thread::Priority::highest);
+    }
+
+    availableWorkers.store(numWorkers);
+}
+
+void FreOscParallelVoiceRenderer::stopWorkers(int numWorkers)
+{
+    const int runningWorkers = availableWorkers.load();
+    if (numWorkers >= runningWorkers)
+        return;
+
+    // Hide the workers from the next block, then wait for a block that may still use them
+    availableWorkers.store(numWorkers);
+    while (rendering.load())
+        juce::Thread::sleep(1);
+
+    for (int index = numWorkers; index < runningWorkers; ++index)
+    {
+        workers[index]->stop();
+        workers[index].reset();
+        chunkBuffers[index + 1].setSize(0, 0);
+    }
+}
+
+void FreOscParallelVoiceRenderer::setWaitStrategy(WaitStrategy strategy)
+{
+    waitStrategy.store(static_cast<int>(strategy), std::memory_order_relaxed);
+}
+
+//==============================================================================
+void FreOscParallelVoiceRenderer::render(const juce::OwnedArray<juce::SynthesiserVoice>& voices,
+                                         juce::AudioBuffer<float>& outputBuffer, int startSample, int numSamples)
+{
+    activeVoices.clearQuick();
+    for (auto* voice : voices)
+        if (voice->isVoiceActive())
+            activeVoices.add(voice);
+
+    // Announce the block before reading the worker count, so the timer can't stop
+    // workers this block goes on to use
+    rendering.store(true);
+
+    const int availableThreads = juce::jmin(requestedThreads.load(std::memory_order_relaxed), availableWorkers.load() + 1);
+    const int maximumChunks = activeVoices.size() / getMinimumParallelVoices() + 1;
+    const bool fitsScratch = numSamples <= chunkBuffers[0].getNumSamples();
+
+    numChunks = juce::jmin(availableThreads, maximumChunks);
+
+    // Serial fallback - same as juce::Synthesiser::renderVoices
+    if (numChunks <= 1 || !fitsScratch || activeVoices.size() < getMinimumParallelVoices())
+    {
+        rendering.store(false);
+
+        for (auto* voice : activeVoices)
+            voice->renderNextBlock(outputBuffer, startSample, numSamples);
+        return;
+    }
+
+    jobNumSamples = numSamples;
+    pendingChunks.store(numChunks - 1, std::memory_order_release);
+
+    for (int chunk = 1; chunk < numChunks; ++chunk)
+        workers[chunk - 1]->dispatch();
+
+    renderChunk(0);
+    waitForWorkers();
+
+    // Sum in chunk order so the mix is deterministic
+    const int numChannels = juce::jmin(outputBuffer.getNumChannels(), 2);
+
+    for (int chunk = 0; chunk < numChunks; ++chunk)
+        for (int channel = 0; channel < numChannels; ++channel)
+            outputBuffer.addFrom(channel, startSample, chunkBuffers[chunk], channel, 0, numSamples);
+
+    rendering.store(false);
+}
+
+void FreOscParallelVoiceRenderer::renderChunk(int chunkIndex)
+{
+    auto& chunkBuffer = chunkBuffers[chunkIndex];
+    chunkBuffer.clear(0, jobNumSamples);
+
+    // Round-robin so long-held voices are spread across the chunks
+    for (int i = chunkIndex; i < activeVoices.size(); i += numChunks)
+        activeVoices.getUnchecked(i)->renderNextBlock(chunkBuffer, 0, jobNumSamples);
+}
+
+void FreOscParallelVoiceRenderer::waitForWorkers()
+{
+    const bool spin = static_cast<WaitStrategy>(waitStrategy.load(std::memory_order_relaxed)) == WaitStrategy::Spin;
+
+    while (pendingChunks.load(std::memory_order_acquire) > 0)
+    {
+        if (!spin)
+            std::this_thread::yield();
+    }
+}
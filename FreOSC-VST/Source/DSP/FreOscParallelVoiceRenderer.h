@@ -0,0 +1,100 @@
+#pragma once
+
+#include <juce_audio_basics/juce_audio_basics.h>
+#include <juce_events/juce_events.h>
+#include <atomic>
+#include <memory>
+
+//==============================================================================
+/**
+    FreOSC Parallel Voice Renderer
+
+    Renders the active voices of a synthesiser on a pool of real-time worker
+    threads. The pool follows setNumThreads(): a message thread timer starts
+    workers when more threads are asked for and stops them again when the
+    count drops, so a serial setup owns no threads at all. The audio thread
+    never starts or stops a thread; it only uses the workers published to it.
+
+    Each block the active voices are dealt round-robin into one chunk per
+    thread (the audio thread renders chunk 0 itself). Every chunk renders
+    into its own preallocated stereo scratch buffer, and the chunks are
+    summed into the output in chunk order, so the result does not depend on
+    which thread finishes first.
+
+    With fewer active voices than getMinimumParallelVoices(), or with a
+    single thread configured, voices are rendered serially exactly like
+    juce::Synthesiser does.
+*/
+class FreOscParallelVoiceRenderer : private juce::Timer
+{
+public:
+    //==============================================================================
+    // How idle workers (and the audio thread, while waiting for them) wait
+    enum class WaitStrategy
+    {
+        Spin = 0,   // Busy-wait - lowest latency, burns a core per worker
+        Yield,      // Busy-wait but yield the time slice between checks
+        Block       // Sleep on an event between blocks
+    };
+
+    static constexpr int maxThreads = 16;   // Including the audio thread
+
+    //==============================================================================
+    FreOscParallelVoiceRenderer();
+    ~FreOscParallelVoiceRenderer() override;
+
+    //==============================================================================
+    // Allocates scratch buffers and starts following setNumThreads() (not on the audio thread)
+    void prepare(double sampleRate, int maximumBlockSize, int maximumVoices);
+    void release();
+
+    // Threads used per block including the audio thread (1 = serial). Safe on the
+    // audio thread; until the timer has started the workers, fewer threads are used
+    void setNumThreads(int numThreads);
+    void setWaitStrategy(WaitStrategy strategy);
+
+    static constexpr int getMinimumParallelVoices() { return 4; }
+
+    //==============================================================================
+    // Adds all active voices into the output buffer
+    void render(const juce::OwnedArray<juce::SynthesiserVoice>& voices,
+                juce::AudioBuffer<float>& outputBuffer, int startSample, int numSamples);
+
+private:
+    //==============================================================================
+    class Worker;
+
+    // Worker i renders chunk i + 1 into chunkBuffers[i + 1]; chunk 0 is the audio thread's
+    std::unique_ptr<Worker> workers[maxThreads - 1];
+    juce::AudioBuffer<float> chunkBuffers[maxThreads];
+
+    juce::Array<juce::SynthesiserVoice*> activeVoices;          // Preallocated in prepare()
+
+    std::atomic<int> requestedThreads { 1 };
+    std::atomic<int> waitStrategy { static_cast<int>(WaitStrategy::Yield) };
+
+    // Workers the audio thread may use, published by the timer once they are running.
+    // While rendering is set the audio thread may still be using a count read earlier.
+    std::atomic<int> availableWorkers { 0 };
+    std::atomic<bool> rendering { false };
+
+    // Settings for workers started later (message thread)
+    int workerBlockSize = 0;
+    juce::Thread::RealtimeOptions workerOptions;
+
+    // Current job - written by the audio thread before the workers are woken
+    int numChunks = 1;
+    int jobNumSamples = 0;
+    std::atomic<int> pendingChunks { 0 };
+
+    //==============================================================================
+    void renderChunk(int chunkIndex);
+    void waitForWorkers();
+
+    void timerCallback() override;
+    void startWorkers(int numWorkers);
+    void stopWorkers(int numWorkers);
+
+    //==============================================================================
+    JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR(FreOscParallelVoiceRenderer)
+};
@@ -0,0 +1,63 @@
+#include "FreOscProfiling.h"
+
+//==============================================================================
+const char* FreOscProfilingStats::getStageName(Stage stage)
+{
+    switch (stage)
+    {
+        case VoiceModulation:   return "Voice Modulation";
+        case VoiceOscillators:  return "Voice Oscillators";
+        case VoicePM:           return "Voice PM";
+        case VoiceFM:           return "Voice FM";
+        case VoiceNoise:        return "Voice Noise";
+        case VoiceFilters:      return "Voice Filters";
+        case VoicePanMix:       return "Voice Pan/Mix";
+        case Voices:            return "Voices";
+        case Compressor:        return "Compressor";
+        case Limiter:           return "Limiter";
+        case Wavefolder:        return "Wavefolder";
+        case Reverb:            return "Reverb";
+        case Delay:             return "Delay";
+        case MasterGain:        return "Master Gain";
+        case ProcessBlock:      return "Process Block";
+        case NumStages:
+        default:                break;
+    }
+
+    return "Unknown";
+}
+
+//==============================================================================
+FreOscProfilingStats::Snapshot FreOscProfilingStats::getSnapshot() const
+{
+    Snapshot snapshot;
+
+    for (int stage = 0; stage < NumStages; ++stage)
+    {
+        snapshot.stageSeconds[stage] = juce::Time::highResolutionTicksToSeconds(stageTicks[stage].load(std::memory_order_relaxed));
+        snapshot.stageCalls[stage] = stageCalls[stage].load(std::memory_order_relaxed);
+    }
+
+    for (int voice = 0; voice < maxVoices; ++voice)
+        snapshot.voiceActiveSamples[voice] = voiceActiveSamples[voice].load(std::memory_order_relaxed);
+
+    snapshot.numBlocks = numBlocks.load(std::memory_order_relaxed);
+    snapshot.numSamples = numSamplesProcessed.load(std::memory_order_relaxed);
+
+    return snapshot;
+}
+
+void FreOscProfilingStats::reset() noexcept
+{
+    for (auto& ticks : stageTicks)
+        ticks.store(0, std::memory_order_relaxed);
+
+    for (auto& calls : stageCalls)
+        calls.store(0, std::memory_order_relaxed);
+
+    for (auto& samples : voiceActiveSamples)
+        samples.store(0, std::memory_order_relaxed);
+
+    numBlocks.store(0, std::memory_order_relaxed);
+    numSamplesProcessed.store(0, std::memory_order_relaxed);
+}
@@ -0,0 +1,138 @@
+#pragma once
+
+#include <juce_core/juce_core.h>
+#include <atomic>
+
+//==============================================================================
+// Compile-time switch for the CPU instrumentation (CMake option FREOSC_ENABLE_PROFILING).
+// When off, the FREOSC_PROFILE_* macros compile to nothing.
+#ifndef FREOSC_ENABLE_PROFILING
+ #define FREOSC_ENABLE_PROFILING 0
+#endif
+
+//==============================================================================
+/**
+    FreOSC Profiling Stats
+
+    Lock-free CPU statistics filled in by the voices and the processor and
+    polled by the editor or a test harness:
+    - high resolution tick totals and call counts per render stage
+    - active sample counts per voice
+    - processed block and sample counts
+
+    Every counter is a relaxed atomic, so voices rendering on worker threads
+    can add to the same stats block without locking. getSnapshot() converts
+    the totals to seconds.
+*/
+class FreOscProfilingStats
+{
+public:
+    //==============================================================================
+    enum Stage
+    {
+        // Per voice (summed over all voices)
+        VoiceModulation = 0,    // Envelopes, LFOs, modulation routing
+        VoiceOscillators,
+        VoicePM,
+        VoiceFM,
+        VoiceNoise,
+        VoiceFilters,
+        VoicePanMix,            // Gain, DC blocker, clipping and panning into the output
+
+        // Per block
+        Voices,                 // Whole synthesiser render
+        Compressor,
+        Limiter,
+        Wavefolder,
+        Reverb,
+        Delay,
+        MasterGain,
+        ProcessBlock,           // Whole processBlock
+
+        NumStages
+    };
+
+    static constexpr int maxVoices = 128;
+
+    static const char* getStageName(Stage stage);
+
+    //==============================================================================
+    void addStageTicks(Stage stage, juce::int64 ticks) noexcept
+    {
+        stageTicks[stage].fetch_add(ticks, std::memory_order_relaxed);
+        stageCalls[stage].fetch_add(1, std::memory_order_relaxed);
+    }
+
+    void addVoiceSamples(int voiceIndex, int numSamples) noexcept
+    {
+        if (juce::isPositiveAndBelow(voiceIndex, maxVoices))
+            voiceActiveSamples[voiceIndex].fetch_add(static_cast<juce::uint64>(numSamples), std::memory_order_relaxed);
+    }
+
+    void addBlock(int numSamples) noexcept
+    {
+        numBlocks.fetch_add(1, std::memory_order_relaxed);
+        numSamplesProcessed.fetch_add(static_cast<juce::uint64>(numSamples), std::memory_order_relaxed);
+    }
+
+    //==============================================================================
+    // Point-in-time copy of all counters
+    struct Snapshot
+    {
+        double stageSeconds[NumStages] = {};
+        juce::uint64 stageCalls[NumStages] = {};
+        juce::uint64 voiceActiveSamples[maxVoices] = {};
+        juce::uint64 numBlocks = 0;
+        juce::uint64 numSamples = 0;
+    };
+
+    Snapshot getSnapshot() const;
+    void reset() noexcept;
+
+    //==============================================================================
+    // Adds the time between construction and destruction to a stage
+    class ScopedTimer
+    {
+    public:
+        ScopedTimer(FreOscProfilingStats* statsToUse, Stage stageToTime) noexcept
+            : stats(statsToUse), stage(stageToTime),
+              startTicks(statsToUse != nullptr ? juce::Time::getHighResolutionTicks() : 0)
+        {
+        }
+
+        ~ScopedTimer() noexcept
+        {
+            if (stats != nullptr)
+                stats->addStageTicks(stage, juce::Time::getHighResolutionTicks() - startTicks);
+        }
+
+    private:
+        FreOscProfilingStats* stats;
+        const Stage stage;
+        const juce::int64 startTicks;
+
+        JUCE_DECLARE_NON_COPYABLE(ScopedTimer)
+    };
+
+private:
+    //==============================================================================
+    std::atomic<juce::int64> stageTicks[NumStages] = {};
+    std::atomic<juce::uint64> stageCalls[NumStages] = {};
+    std::atomic<juce::uint64> voiceActiveSamples[maxVoices] = {};
+    std::atomic<juce::uint64> numBlocks { 0 };
+    std::atomic<juce::uint64> numSamplesProcessed { 0 };
+};
+
+//==============================================================================
+#if FREOSC_ENABLE_PROFILING
+ #define FREOSC_PROFILE_STAGE(stats, stage) \
+    const FreOscProfilingStats::ScopedTimer JUCE_JOIN_MACRO(freOscStageTimer_, __LINE__) (stats, FreOscProfilingStats::stage)
+ #define FREOSC_PROFILE_VOICE_SAMPLES(stats, voiceIndex, numSamples) \
+    if ((stats) != nullptr) (stats)->addVoiceSamples(voiceIndex, numSamples)
+ #define FREOSC_PROFILE_BLOCK(stats, numSamples) \
+    if ((stats) != nullptr) (stats)->addBlock(numSamples)
+#else
+ #define FREOSC_PROFILE_STAGE(stats, stage)
+ #define FREOSC_PROFILE_VOICE_SAMPLES(stats, voiceIndex, numSamples) juce::ignoreUnused(stats, voiceIndex, numSamples)
+ #define FREOSC_PROFILE_BLOCK(stats, numSamples) juce::ignoreUnused(stats, numSamples)
+#endif
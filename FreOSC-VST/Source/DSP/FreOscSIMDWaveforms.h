@@ -0,0 +1,268 @@
+#pragma once
+
+#include <juce_dsp/juce_dsp.h>
+#include "FreOscOscillator.h"
+#include "FreOscFastMath.h"
+
+//==============================================================================
+/**
+    FreOSC SIMD Waveforms
+
+    Lane-wise versions of the FreOscOscillator waveform kernels on
+    juce::dsp::SIMDRegister, shared by the voice bank and by unison
+    oscillators. Phases are the normalised 32-bit accumulators of
+    FreOscFastMath, one per lane.
+
+    The kernels are inline and take the waveform and sine precision as
+    template arguments. dispatchKernel() resolves them once per block, so
+    the caller's sample loop runs a single kernel without branches or calls.
+*/
+class FreOscSIMDWaveforms
+{
+public:
+    //==============================================================================
+    using Register = juce::dsp::SIMDRegister<float>;
+    using Mask = Register::vMaskType;
+    using PhaseRegister = juce::dsp::SIMDRegister<FreOscFastMath::Phase>;
+    using Waveform = FreOscOscillator::Waveform;
+    using RenderMode = FreOscOscillator::RenderMode;
+    using Precision = FreOscFastMath::Precision;
+
+    static constexpr int numLanes = static_cast<int>(Register::SIMDNumElements);
+    static_assert(PhaseRegister::SIMDNumElements == Register::SIMDNumElements, "Phase and sample lanes must line up");
+
+    //==============================================================================
+    // Calls render(kernel) with the kernel for one oscillator setting. Kernels take the
+    // lane phases, dt (cycles per sample) and 1/dt. The table is only read in the
+    // Wavetable and Additive modes; without one those modes fall back to PolyBLEP.
+    template <typename Render>
+    static void dispatchKernel(Waveform waveform, RenderMode renderMode, Precision precision,
+                               const FreOscWavetable* table, Render&& render);
+
+    //==============================================================================
+    static Register phaseToRadians(PhaseRegister phase);        // [0, 2*pi)
+    static Register phaseToSignedCycles(PhaseRegister phase);   // [-0.5, 0.5)
+
+    template <Precision precision>
+    static Register sinPhase(PhaseRegister phase);
+    static Register sinPolynomialCycles(Register cycles);       // cycles in [-0.5, 0.5]
+
+    // Square, sawtooth and triangle - sines go through sinPhase(). phaseValue in [0, 2*pi)
+    template <Waveform waveform>
+    static Register generateWaveform(Register phaseValue);
+    template <Waveform waveform>
+    static Register generateBandLimitedWaveform(Register phaseValue, Register dt, Register inverseDt);
+    static Register generateWavetable(const FreOscWavetable& table, PhaseRegister phase, Register dt);
+
+    static Register polyBlep(Register t, Register dt, Register inverseDt);
+    static Register polyBlamp(Register t, Register dt, Register inverseDt);
+    static Register select(Mask mask, Register whenTrue, Register whenFalse);
+
+private:
+    FreOscSIMDWaveforms() = delete;
+};
+
+//==============================================================================
+// Inline kernel implementations
+
+template <typename Render>
+void FreOscSIMDWaveforms::dispatchKernel(Waveform waveform, RenderMode renderMode, Precision precision,
+                                         const FreOscWavetable* table, Render&& render)
+{
+    // A sine has no harmonics to band-limit in any render mode
+    if (waveform == Waveform::Sine)
+    {
+        switch (precision)
+        {
+            case Precision::Polynomial: render([](PhaseRegister phase, Register, Register) { return sinPhase<Precision::Polynomial>(phase); }); break;
+            case Precision::Table:      render([](PhaseRegister phase, Register, Register) { return sinPhase<Precision::Table>(phase); }); break;
+            case Precision::Exact:
+            default:                    render([](PhaseRegister phase, Register, Register) { return sinPhase<Precision::Exact>(phase); }); break;
+        }
+        return;
+    }
+
+    if (table != nullptr && (renderMode == RenderMode::Wavetable || renderMode == RenderMode::Additive))
+    {
+        render([table](PhaseRegister phase, Register dt, Register) { return generateWavetable(*table, phase, dt); });
+        return;
+    }
+
+    auto renderForWaveform = [&](auto makeKernel)
+    {
+        switch (waveform)
+        {
+            case Waveform::Square:   render(makeKernel(std::integral_constant<Waveform, Waveform::Square>())); break;
+            case Waveform::Sawtooth: render(makeKernel(std::integral_constant<Waveform, Waveform::Sawtooth>())); break;
+            case Waveform::Triangle:
+            default:                 render(makeKernel(std::integral_constant<Waveform, Waveform::Triangle>())); break;
+        }
+    };
+
+    if (renderMode == RenderMode::Raw)
+    {
+        renderForWaveform([](auto waveformConstant)
+        {
+            return [](PhaseRegister phase, Register, Register)
+            {
+                return generateWaveform<decltype(waveformConstant)::value>(phaseToRadians(phase));
+            };
+        });
+    }
+    else
+    {
+        renderForWaveform([](auto waveformConstant)
+        {
+            return [](PhaseRegister phase, Register dt, Register inverseDt)
+            {
+                return generateBandLimitedWaveform<decltype(waveformConstant)::value>(phaseToRadians(phase), dt, inverseDt);
+            };
+        });
+    }
+}
+
+//==============================================================================
+inline FreOscSIMDWaveforms::Register FreOscSIMDWaveforms::phaseToRadians(PhaseRegister phase)
+{
+    // No integer to float conversion in SIMDRegister - go through aligned arrays,
+    // which the compiler turns back into a vector shift and convert
+    alignas(Register::SIMDRegisterSize) FreOscFastMath::Phase steps[Register::SIMDNumElements];
+    alignas(Register::SIMDRegisterSize) float radians[Register::SIMDNumElements];
+
+    phase.copyToRawArray(steps);
+    for (size_t index = 0; index < Register::SIMDNumElements; ++index)
+        radians[index] = FreOscFastMath::phaseToRadians(steps[index]);
+
+    return Register::fromRawArray(radians);
+}
+
+inline FreOscSIMDWaveforms::Register FreOscSIMDWaveforms::phaseToSignedCycles(PhaseRegister phase)
+{
+    // Same as phaseToRadians(): a vector convert once the compiler sees the loop
+    alignas(Register::SIMDRegisterSize) FreOscFastMath::Phase steps[Register::SIMDNumElements];
+    alignas(Register::SIMDRegisterSize) float cycles[Register::SIMDNumElements];
+
+    phase.copyToRawArray(steps);
+    for (size_t index = 0; index < Register::SIMDNumElements; ++index)
+        cycles[index] = FreOscFastMath::phaseDeltaToCycles(steps[index]);
+
+    return Register::fromRawArray(cycles);
+}
+
+template <FreOscFastMath::Precision precision>
+FreOscSIMDWaveforms::Register FreOscSIMDWaveforms::sinPhase(PhaseRegister phase)
+{
+    if constexpr (precision == Precision::Polynomial)
+    {
+        // The signed phase is already the reduced argument
+        return sinPolynomialCycles(phaseToSignedCycles(phase));
+    }
+    else
+    {
+        // Table reads are gathers and std::sin has no vector form - lane by lane
+        Register result;
+        for (size_t index = 0; index < Register::size(); ++index)
+            result.set(index, FreOscFastMath::sinPhase(phase.get(index), precision));
+        return result;
+    }
+}
+
+inline FreOscSIMDWaveforms::Register FreOscSIMDWaveforms::sinPolynomialCycles(Register u)
+{
+    // Lane-wise FreOscFastMath::sinPolynomialCycles. The polynomial is odd, so fold
+    // |u| to [0, 0.25] cycles and put the sign back on the result
+    const auto magnitude = Register::abs(u);
+    const auto folded = Register::min(magnitude, Register::expand(0.5f) - magnitude);
+
+    const auto x = folded * juce::MathConstants<float>::twoPi;
+    const auto x2 = x * x;
+
+    // Minimax coefficients for sin on [-pi/2, pi/2]
+    auto result = x2 * 2.5904894855190e-6f + Register::expand(-0.00019800898342093f);
+    result = x2 * result + Register::expand(0.0083328998347224f);
+    result = x2 * result + Register::expand(-0.16666647635470586f);
+    result = x2 * result + Register::expand(0.99999997659155f);
+    result = x * result;
+
+    return select(Register::lessThan(u, Register::expand(0.0f)), Register::expand(0.0f) - result, result);
+}
+
+template <FreOscOscillator::Waveform waveform>
+FreOscSIMDWaveforms::Register FreOscSIMDWaveforms::generateWaveform(Register phaseValue)
+{
+    static_assert(waveform != Waveform::Sine, "Sines go through sinPhase()");
+
+    const auto one = Register::expand(1.0f);
+    constexpr float inversePi = 1.0f / juce::MathConstants<float>::pi;
+
+    if constexpr (waveform == Waveform::Square)
+        return select(Register::lessThan(phaseValue, Register::expand(juce::MathConstants<float>::pi)), one, Register::expand(-1.0f));
+    else if constexpr (waveform == Waveform::Sawtooth)
+        return phaseValue * inversePi - one;
+    else
+        return one - Register::abs(phaseValue * inversePi - one) * 2.0f;
+}
+
+template <FreOscOscillator::Waveform waveform>
+FreOscSIMDWaveforms::Register FreOscSIMDWaveforms::generateBandLimitedWaveform(Register phaseValue, Register dt, Register inverseDt)
+{
+    const auto one = Register::expand(1.0f);
+    constexpr float cyclesPerRadian = 1.0f / juce::MathConstants<float>::twoPi;
+
+    // Phase in cycles, and the same phase half a cycle later
+    const auto t = phaseValue * cyclesPerRadian;
+    auto halfCycle = t + 0.5f;
+    halfCycle -= one & Register::greaterThanOrEqual(halfCycle, one);
+
+    if constexpr (waveform == Waveform::Square)
+        return generateWaveform<waveform>(phaseValue) + polyBlep(t, dt, inverseDt) - polyBlep(halfCycle, dt, inverseDt);
+    else if constexpr (waveform == Waveform::Sawtooth)
+        return generateWaveform<waveform>(phaseValue) - polyBlep(t, dt, inverseDt);
+    else
+        return generateWaveform<waveform>(phaseValue)
+             + dt * 4.0f * (polyBlamp(t, dt, inverseDt) - polyBlamp(halfCycle, dt, inverseDt));
+}
+
+inline FreOscSIMDWaveforms::Register FreOscSIMDWaveforms::generateWavetable(const FreOscWavetable& table, PhaseRegister phase, Register dt)
+{
+    // Table reads are gathers - lane by lane
+    Register result;
+    for (size_t index = 0; index < Register::size(); ++index)
+        result.set(index, table.getSample(FreOscWavetable::getMipLevel(dt.get(index)),
+                                          FreOscFastMath::phaseToCycles(phase.get(index))));
+    return result;
+}
+
+inline FreOscSIMDWaveforms::Register FreOscSIMDWaveforms::polyBlep(Register t, Register dt, Register inverseDt)
+{
+    // Lane-wise FreOscOscillator::polyBlep
+    const auto one = Register::expand(1.0f);
+
+    const auto after = t * inverseDt;
+    const auto afterValue = after + after - after * after - one;
+
+    const auto before = (t - one) * inverseDt;
+    const auto beforeValue = before * before + before + before + one;
+
+    return (afterValue & Register::lessThan(t, dt)) + (beforeValue & Register::greaterThan(t, one - dt));
+}
+
+inline FreOscSIMDWaveforms::Register FreOscSIMDWaveforms::polyBlamp(Register t, Register dt, Register inverseDt)
+{
+    // Lane-wise FreOscOscillator::polyBlamp
+    const auto one = Register::expand(1.0f);
+    constexpr float oneThird = 1.0f / 3.0f;
+
+    const auto after = t * inverseDt - one;
+    const auto afterValue = after * after * after * -oneThird;
+
+    const auto before = (t - one) * inverseDt + one;
+    const auto beforeValue = before * before * before * oneThird;
+
+    return (afterValue & Register::lessThan(t, dt)) + (beforeValue & Register::greaterThan(t, one - dt));
+}
+
+inline FreOscSIMDWaveforms::Register FreOscSIMDWaveforms::select(Mask mask, Register whenTrue, Register whenFalse)
+{
+    return (whenTrue & mask) + (whenFalse & ~mask);
+}
@@ -0,0 +1,99 @@
+#include "FreOscSynthesiser.h"
+#include "FreOscVoice.h"
+
+//==============================================================================
+FreOscSynthesiser::FreOscSynthesiser()
+{
+}
+
+FreOscSynthesiser::~FreOscSynthesiser()
+{
+    // Workers must be gone before the voices they render
+    renderer.release();
+}
+
+//==============================================================================
+void FreOscSynthesiser::prepareRenderer(double playbackSampleRate, int maximumBlockSize)
+{
+    renderer.prepare(playbackSampleRate, maximumBlockSize, voices.size());
+}
+
+void FreOscSynthesiser::releaseRenderer()
+{
+    renderer.release();
+}
+
+//==============================================================================
+void FreOscSynthesiser::renderVoices(juce::AudioBuffer<float>& outputAudio, int startSample, int numSamples)
+{
+    renderer.render(voices, outputAudio, startSample, numSamples);
+}
+
+//==============================================================================
+void FreOscSynthesiser::setVoiceLimit(int newVoiceLimit)
+{
+    voiceLimit = juce::jlimit(1, maxVoices, newVoiceLimit);
+}
+
+juce::SynthesiserVoice* FreOscSynthesiser::findFreeVoice(juce::SynthesiserSound* soundToPlay, int midiChannel,
+                                                         int midiNoteNumber, bool stealIfNoneAvailable) const
+{
+    const juce::ScopedLock sl(lock);
+
+    for (int i = 0; i < getNumUsableVoices(); ++i)
+    {
+        auto* voice = voices.getUnchecked(i);
+
+        if (!voice->isVoiceActive() && voice->canPlaySound(soundToPlay))
+            return voice;
+    }
+
+    if (stealIfNoneAvailable)
+        return findVoiceToSteal(soundToPlay, midiChannel, midiNoteNumber);
+
+    return nullptr;
+}
+
+juce::SynthesiserVoice* FreOscSynthesiser::findVoiceToSteal(juce::SynthesiserSound* soundToPlay, int midiChannel,
+                                                            int midiNoteNumber) const
+{
+    juce::ignoreUnused(midiChannel);
+
+    // Stealing order: releasing voices, then sustained (key up), then held voices
+    auto getStage = [](juce::SynthesiserVoice* voice, const FreOscVoice* freOscVoice)
+    {
+        if (freOscVoice != nullptr && freOscVoice->isReleasing())
+            return 0;
+
+        return voice->isKeyDown() ? 2 : 1;
+    };
+
+    juce::SynthesiserVoice* bestVoice = nullptr;
+    int bestStage = 0;
+    float bestLevel = 0.0f;
+
+    for (int i = 0; i < getNumUsableVoices(); ++i)
+    {
+        auto* voice = voices.getUnchecked(i);
+
+        if (!voice->canPlaySound(soundToPlay))
+            continue;
+
+        // Retrigger a voice that is already playing this note
+        if (voice->getCurrentlyPlayingNote() == midiNoteNumber)
+            return voice;
+
+        const auto* freOscVoice = dynamic_cast<const FreOscVoice*>(voice);
+        const int stage = getStage(voice, freOscVoice);
+        const float level = freOscVoice != nullptr ? freOscVoice->getCurrentLevel() : 1.0f;
+
+        if (bestVoice == nullptr || stage < bestStage || (stage == bestStage && level < bestLevel))
+        {
+            bestVoice = voice;
+            bestStage = stage;
+            bestLevel = level;
+        }
+    }
+
+    return bestVoice;
+}
@@ -0,0 +1,60 @@
+#pragma once
+
+#include <juce_audio_basics/juce_audio_basics.h>
+#include "FreOscParallelVoiceRenderer.h"
+
+//==============================================================================
+/**
+    FreOSC Synthesiser
+
+    juce::Synthesiser that renders its voices through a
+    FreOscParallelVoiceRenderer, so voices can be spread across worker
+    threads instead of being rendered one after another.
+
+    The voice pool is allocated up front (up to maxVoices); setVoiceLimit()
+    chooses how many of those voices may play, so polyphony can change
+    without allocating. When stealing, releasing voices go first, then
+    voices whose key is up, and within each the quietest one by envelope
+    level (FreOscVoice only - other voices count as full level).
+*/
+class FreOscSynthesiser : public juce::Synthesiser
+{
+public:
+    //==============================================================================
+    FreOscSynthesiser();
+    ~FreOscSynthesiser() override;
+
+    //==============================================================================
+    // Spawns the render workers - call from prepareToPlay
+    void prepareRenderer(double playbackSampleRate, int maximumBlockSize);
+    void releaseRenderer();
+
+    FreOscParallelVoiceRenderer& getRenderer() { return renderer; }
+
+    //==============================================================================
+    static constexpr int maxVoices = 128;
+
+    // Number of pool voices that may play new notes (voices above the limit finish their notes)
+    void setVoiceLimit(int newVoiceLimit);
+    int getVoiceLimit() const { return voiceLimit; }
+
+protected:
+    //==============================================================================
+    using juce::Synthesiser::renderVoices;
+    void renderVoices(juce::AudioBuffer<float>& outputAudio, int startSample, int numSamples) override;
+
+    juce::SynthesiserVoice* findFreeVoice(juce::SynthesiserSound* soundToPlay, int midiChannel,
+                                          int midiNoteNumber, bool stealIfNoneAvailable) const override;
+    juce::SynthesiserVoice* findVoiceToSteal(juce::SynthesiserSound* soundToPlay, int midiChannel,
+                                             int midiNoteNumber) const override;
+
+private:
+    //==============================================================================
+    FreOscParallelVoiceRenderer renderer;
+    int voiceLimit = maxVoices;
+
+    int getNumUsableVoices() const { return juce::jmin(voiceLimit, voices.size()); }
+
+    //==============================================================================
+    JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR(FreOscSynthesiser)
+};
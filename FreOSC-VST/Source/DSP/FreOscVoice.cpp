@@ -1,8 +1,12 @@
 #include "FreOscVoice.h"
 #include "FreOscSound.h"
 
+// Used until the processor publishes its first snapshot
+static const FreOscVoiceParameters defaultVoiceParameters;
+
 //==============================================================================
 FreOscVoice::FreOscVoice()
+    : params(&defaultVoiceParameters)
 {
     // Initialize custom envelope with default parameters
     envelopeParameters.attack = 0.1f;
@@ -25,11 +29,11 @@ FreOscVoice::FreOscVoice()
     modEnvelope2.setParameters(modEnv2Parameters);
 
     // Initialize oscillators with safe defaults to match voice parameters
-    oscillator1.setLevel(params.osc1Level.load());
+    oscillator1.setLevel(params->osc1Level);
     oscillator1.setWaveform(FreOscOscillator::Waveform::Sine);
-    oscillator2.setLevel(params.osc2Level.load());
+    oscillator2.setLevel(params->osc2Level);
     oscillator2.setWaveform(FreOscOscillator::Waveform::Sine);
-    oscillator3.setLevel(params.osc3Level.load());
+    oscillator3.setLevel(params->osc3Level);
     oscillator3.setWaveform(FreOscOscillator::Waveform::Sine);
 
     // Initialize PM modulator (will be synced with OSC3 when needed)
@@ -37,7 +41,7 @@ FreOscVoice::FreOscVoice()
     pmModulator.setWaveform(FreOscOscillator::Waveform::Sine);
 
     // Initialize noise generator
-    noiseGenerator.setLevel(params.noiseLevel.load());
+    noiseGenerator.setLevel(params->noiseLevel);
 }
 
 FreOscVoice::~FreOscVoice()
@@ -54,6 +58,9 @@ void FreOscVoice::startNote(int midiNoteNumber, float velocity, juce::Synthesise
 {
     juce::ignoreUnused(sound);
 
+    // Make sure the DSP objects reflect the latest snapshot before the note starts
+    applyParameters();
+
     currentMidiNote = midiNoteNumber;
     currentVelocity = velocity;
     noteIsOn = true;
@@ -61,28 +68,16 @@ void FreOscVoice::startNote(int midiNoteNumber, float velocity, juce::Synthesise
     // Set initial pitch bend from current wheel position
     currentPitchBend = (currentPitchWheelPosition - 8192) / 8192.0f;
 
-    // Calculate base frequency with pitch bend applied
-    float pitchBendSemitones = currentPitchBend * pitchBendRange;
-    float effectiveNoteNumber = midiNoteNumber + pitchBendSemitones;
-    currentNoteFrequency = static_cast<float>(juce::MidiMessage::getMidiNoteInHertz(static_cast<int>(effectiveNoteNumber)));
-
-    // If fractional note number, interpolate frequency
-    if (std::abs(effectiveNoteNumber - static_cast<int>(effectiveNoteNumber)) > 1e-6f)
-    {
-        float fractionalPart = effectiveNoteNumber - static_cast<int>(effectiveNoteNumber);
-        float lowerFreq = static_cast<float>(juce::MidiMessage::getMidiNoteInHertz(static_cast<int>(effectiveNoteNumber)));
-        float upperFreq = static_cast<float>(juce::MidiMessage::getMidiNoteInHertz(static_cast<int>(effectiveNoteNumber) + 1));
-        currentNoteFrequency = lowerFreq + (upperFreq - lowerFreq) * fractionalPart;
-    }
-
     // Set up oscillators with current note frequency
-    setupOscillators();
+    updateNoteFrequency();
     
     // Reset oscillator phases to prevent pops from random starting phases
     oscillator1.reset();
     oscillator2.reset();
     oscillator3.reset();
     pmModulator.reset();
+    startPMOversampling();
+    fmEngine.noteOn();
 
     // Start envelope
     envelope.noteOn();
@@ -92,40 +87,48 @@ void FreOscVoice::startNote(int midiNoteNumber, float velocity, juce::Synthesise
     modEnvelope2.noteOn();
     
     // Reset envelope mode state for new note
-    int currentMode1 = params.modEnv1Mode.load();
-    int currentMode2 = params.modEnv2Mode.load();
+    int currentMode1 = params->modEnv1Mode;
+    int currentMode2 = params->modEnv2Mode;
     
-    modEnv1IsLooping = (currentMode1 == 2); // Looping mode
-    modEnv2IsLooping = (currentMode2 == 2);
-    modEnv1LoopingActive = (currentMode1 == 2);
-    modEnv2LoopingActive = (currentMode2 == 2);
+    modEnv1State.isLooping = (currentMode1 == 2); // Looping mode
+    modEnv2State.isLooping = (currentMode2 == 2);
+    modEnv1State.loopingActive = (currentMode1 == 2);
+    modEnv2State.loopingActive = (currentMode2 == 2);
     
     // Reset one-shot completion state on new notes (not per-voice lifetime)
-    modEnv1OneShotCompleted = false;
-    modEnv2OneShotCompleted = false;
+    modEnv1State.oneShotCompleted = false;
+    modEnv2State.oneShotCompleted = false;
     
     // Reset rate-based timing state
-    modEnv1CurrentCycleSample = 0;
-    modEnv2CurrentCycleSample = 0;
-    modEnv1CycleActive = false;
-    modEnv2CycleActive = false;
+    modEnv1State.currentCycleSample = 0;
+    modEnv2State.currentCycleSample = 0;
+    modEnv1State.cycleActive = false;
+    modEnv2State.cycleActive = false;
     
     // Calculate initial cycle lengths based on current rates
     if (currentMode1 == 0 || currentMode1 == 2) // One-Shot or Looping
     {
-        modEnv1CycleSamples = currentSampleRate / juce::jmax(0.1f, params.modEnv1Rate.load());
-        modEnv1CycleActive = true;
+        modEnv1State.cycleSamples = currentSampleRate / juce::jmax(0.1f, params->modEnv1Rate);
+        modEnv1State.cycleActive = true;
     }
     if (currentMode2 == 0 || currentMode2 == 2) // One-Shot or Looping
     {
-        modEnv2CycleSamples = currentSampleRate / juce::jmax(0.1f, params.modEnv2Rate.load());
-        modEnv2CycleActive = true;
+        modEnv2State.cycleSamples = currentSampleRate / juce::jmax(0.1f, params->modEnv2Rate);
+        modEnv2State.cycleActive = true;
     }
     
     // Track current modes for change detection
-    modEnv1LastMode = currentMode1;
-    modEnv2LastMode = currentMode2;
+    modEnv1State.lastMode = currentMode1;
+    modEnv2State.lastMode = currentMode2;
+
+    // Evaluate modulation on the first sample and start from those values
+    controlRate.samplesRemaining = 0;
+    controlRate.needsReset = true;
     
+    // Start audibility tracking afresh
+    lastPeak = 0.0f;
+    quietSamples = 0;
+
     // Initialize amplitude ramping for anti-pop (20ms fade-in)
     amplitudeRamp.reset(currentSampleRate, 0.02); // 20ms ramp
     amplitudeRamp.setCurrentAndTargetValue(0.0f);
@@ -143,21 +146,22 @@ void FreOscVoice::stopNote(float velocity, bool allowTailOff)
     {
         // Let the envelope handle the release
         envelope.noteOff();
+        fmEngine.noteOff();
         
         // Handle modulation envelope release based on mode
         // Gate mode (1): Standard noteOff behavior
         // One-Shot mode (0): Don't call noteOff, let it complete naturally
         // Looping mode (2): Stop looping and go to release phase
         
-        int currentMode1 = params.modEnv1Mode.load();
-        int currentMode2 = params.modEnv2Mode.load();
+        int currentMode1 = params->modEnv1Mode;
+        int currentMode2 = params->modEnv2Mode;
         
         if (currentMode1 == 1) // Gate mode
             modEnvelope1.noteOff();
         else if (currentMode1 == 2) // Looping mode
         {
-            modEnv1IsLooping = false; // Stop looping
-            modEnv1LoopingActive = false; // Deactivate looping
+            modEnv1State.isLooping = false; // Stop looping
+            modEnv1State.loopingActive = false; // Deactivate looping
             modEnvelope1.noteOff(); // Go to release
         }
         // One-Shot mode: Do nothing, let it complete naturally
@@ -166,8 +170,8 @@ void FreOscVoice::stopNote(float velocity, bool allowTailOff)
             modEnvelope2.noteOff();
         else if (currentMode2 == 2) // Looping mode
         {
-            modEnv2IsLooping = false; // Stop looping
-            modEnv2LoopingActive = false; // Deactivate looping
+            modEnv2State.isLooping = false; // Stop looping
+            modEnv2State.loopingActive = false; // Deactivate looping
             modEnvelope2.noteOff(); // Go to release
         }
         // One-Shot mode: Do nothing, let it complete naturally
@@ -189,7 +193,7 @@ void FreOscVoice::pitchWheelMoved(int newPitchWheelValue)
     // Update oscillator frequencies with pitch bend applied
     if (noteIsOn)
     {
-        setupOscillators();
+        updateNoteFrequency();
     }
 }
 
@@ -232,189 +236,133 @@ void FreOscVoice::renderNextBlock(juce::AudioBuffer<float>& outputBuffer, int st
     if (!isVoiceActive())
         return;
 
+    applyParameters();
+
     // Critical fix: Check if ALL audio sources are truly at zero to prevent phantom audio
     if (oscillator1.getCurrentLevel() <= 0.0f &&
         oscillator2.getCurrentLevel() <= 0.0f &&
         oscillator3.getCurrentLevel() <= 0.0f &&
-        params.noiseLevel.load() <= 0.0f)
+        params->fmLevel <= 0.0f &&
+        params->noiseLevel <= 0.0f)
     {
         // All sources are off - produce absolute silence
         return;
     }
 
-    // Process each sample
-    for (int sample = 0; sample < numSamples; ++sample)
+    // Render in sub-blocks that fit the voice-local scratch buffers
+    int samplesRendered = 0;
+
+    while (numSamples > 0)
     {
-        // Get envelope level
-        float envelopeLevel = envelope.getNextSample();
-        
-        // Get modulation envelope levels with mode-specific processing
-        float modEnv1Level = 0.0f;
-        float modEnv2Level = 0.0f;
-        
-        // Check for mode changes and reset state if needed
-        int currentMode1 = params.modEnv1Mode.load();
-        int currentMode2 = params.modEnv2Mode.load();
-        
-        if (currentMode1 != modEnv1LastMode)
+        const int subBlockSize = juce::jmin(numSamples, maxSubBlockSize);
+        const int numRendered = renderSubBlock(outputBuffer, startSample, subBlockSize);
+        samplesRendered += numRendered;
+
+        // A short return means the voice finished inside this sub-block
+        if (numRendered < subBlockSize)
+            break;
+
+        startSample += subBlockSize;
+        numSamples -= subBlockSize;
+    }
+
+    FREOSC_PROFILE_VOICE_SAMPLES(profilingStats, voiceIndex, samplesRendered);
+}
+
+int FreOscVoice::renderSubBlock(juce::AudioBuffer<float>& outputBuffer, int startSample, int numSamples)
+{
+    // Stage 1: envelopes, LFOs and modulation targets (per sample, into scratch buffers)
+    bool voiceFinished = false;
+    int numRendered = 0;
+    {
+        FREOSC_PROFILE_STAGE(profilingStats, VoiceModulation);
+        numRendered = renderModulationStage(numSamples, voiceFinished);
+    }
+
+    if (numRendered > 0)
+    {
+        // Stage 2: oscillators, PM and noise fill the mix buffer
+        renderSourceStage(numRendered);
+
+        // Stage 3: volume modulation and envelope/velocity/CC gain as vector multiplies
+        for (auto channel : { MixBuffer, SideBuffer })
         {
-            // Mode changed - reset envelope state
-            modEnv1OneShotCompleted = false;
-            modEnv1IsLooping = (currentMode1 == 2);
-            modEnv1LoopingActive = (currentMode1 == 2) && noteIsOn;
-            modEnv1LastMode = currentMode1;
-            
-            // Reset rate-based timing
-            modEnv1CurrentCycleSample = 0;
-            modEnv1CycleActive = (currentMode1 == 0 || currentMode1 == 2) && noteIsOn;
-            if (modEnv1CycleActive)
-            {
-                modEnv1CycleSamples = currentSampleRate / juce::jmax(0.1f, params.modEnv1Rate.load());
-            }
-            
-            // Restart envelope if note is active
-            if (noteIsOn)
-                modEnvelope1.noteOn();
+            if (channel == SideBuffer && !blockModulation.hasSideSignal)
+                continue;
+
+            auto* mix = scratch.getWritePointer(channel);
+
+            if (blockModulation.hasVolumeModulation)
+                juce::FloatVectorOperations::multiply(mix, scratch.getReadPointer(VolumeModBuffer), numRendered);
+
+            // Safety check: prevent NaN/infinity values that could cause crackling
+            sanitiseBuffer(mix, numRendered);
+
+            juce::FloatVectorOperations::multiply(mix, scratch.getReadPointer(GainBuffer), numRendered);
         }
-        
-        if (currentMode2 != modEnv2LastMode)
+
+        // Stage 4: per-voice filtering over the whole sub-block (after envelope, before panning)
         {
-            // Mode changed - reset envelope state
-            modEnv2OneShotCompleted = false;
-            modEnv2IsLooping = (currentMode2 == 2);
-            modEnv2LoopingActive = (currentMode2 == 2) && noteIsOn;
-            modEnv2LastMode = currentMode2;
-            
-            // Reset rate-based timing
-            modEnv2CurrentCycleSample = 0;
-            modEnv2CycleActive = (currentMode2 == 0 || currentMode2 == 2) && noteIsOn;
-            if (modEnv2CycleActive)
-            {
-                modEnv2CycleSamples = currentSampleRate / juce::jmax(0.1f, params.modEnv2Rate.load());
-            }
-            
-            // Restart envelope if note is active
-            if (noteIsOn)
-                modEnvelope2.noteOn();
+            FREOSC_PROFILE_STAGE(profilingStats, VoiceFilters);
+            renderFilterStage(numRendered);
         }
-        
-        // Process ModEnv1 based on current mode
-        switch (currentMode1)
+
+        // Stage 5: polyphony scaling, DC blocking and clipping, then pan into the output
         {
-            case 0: // One-Shot mode (rate-based timing)
-                if (modEnv1CycleActive && !modEnv1OneShotCompleted)
-                {
-                    modEnv1CurrentCycleSample++;
-                    
-                    // Check if cycle is complete
-                    if (modEnv1CurrentCycleSample >= modEnv1CycleSamples)
-                    {
-                        modEnv1OneShotCompleted = true;
-                        modEnv1CycleActive = false;
-                        modEnvelope1.noteOff(); // Start release phase
-                    }
-                    
-                    modEnv1Level = modEnvelope1.getNextSample();
-                    
-                    // Restart envelope if it finishes before cycle time
-                    if (!modEnvelope1.isActive() && modEnv1CycleActive)
-                    {
-                        modEnvelope1.reset();
-                        modEnvelope1.noteOn();
-                    }
-                }
-                else if (!modEnv1OneShotCompleted)
-                {
-                    modEnv1Level = modEnvelope1.getNextSample();
-                }
-                // Once completed, envelope stays at 0
-                break;
-                
-            case 1: // Gate mode (standard ADSR, ignores rate)
-                modEnv1Level = modEnvelope1.getNextSample();
-                break;
-                
-            case 2: // Looping mode (rate-based timing)
-                if (modEnv1CycleActive && noteIsOn)
-                {
-                    modEnv1CurrentCycleSample++;
-                    
-                    // Check if cycle is complete - restart immediately
-                    if (modEnv1CurrentCycleSample >= modEnv1CycleSamples)
-                    {
-                        modEnv1CurrentCycleSample = 0;
-                        modEnvelope1.reset();
-                        modEnvelope1.noteOn();
-                    }
-                    
-                    modEnv1Level = modEnvelope1.getNextSample();
-                }
-                else
-                {
-                    // Note released or looping stopped - normal envelope behavior
-                    modEnv1Level = modEnvelope1.getNextSample();
-                }
-                break;
+            FREOSC_PROFILE_STAGE(profilingStats, VoicePanMix);
+            renderOutputStage(outputBuffer, startSample, numRendered);
         }
-        
-        // Process ModEnv2 based on current mode
-        switch (currentMode2)
+
+        // Free the voice early once its release tail has become inaudible
+        if (!voiceFinished && shouldRetire(numRendered))
         {
-            case 0: // One-Shot mode (rate-based timing)
-                if (modEnv2CycleActive && !modEnv2OneShotCompleted)
-                {
-                    modEnv2CurrentCycleSample++;
-                    
-                    // Check if cycle is complete
-                    if (modEnv2CurrentCycleSample >= modEnv2CycleSamples)
-                    {
-                        modEnv2OneShotCompleted = true;
-                        modEnv2CycleActive = false;
-                        modEnvelope2.noteOff(); // Start release phase
-                    }
-                    
-                    modEnv2Level = modEnvelope2.getNextSample();
-                    
-                    // Restart envelope if it finishes before cycle time
-                    if (!modEnvelope2.isActive() && modEnv2CycleActive)
-                    {
-                        modEnvelope2.reset();
-                        modEnvelope2.noteOn();
-                    }
-                }
-                else if (!modEnv2OneShotCompleted)
-                {
-                    modEnv2Level = modEnvelope2.getNextSample();
-                }
-                // Once completed, envelope stays at 0
-                break;
-                
-            case 1: // Gate mode (standard ADSR, ignores rate)
-                modEnv2Level = modEnvelope2.getNextSample();
-                break;
-                
-            case 2: // Looping mode (rate-based timing)
-                if (modEnv2CycleActive && noteIsOn)
-                {
-                    modEnv2CurrentCycleSample++;
-                    
-                    // Check if cycle is complete - restart immediately
-                    if (modEnv2CurrentCycleSample >= modEnv2CycleSamples)
-                    {
-                        modEnv2CurrentCycleSample = 0;
-                        modEnvelope2.reset();
-                        modEnvelope2.noteOn();
-                    }
-                    
-                    modEnv2Level = modEnvelope2.getNextSample();
-                }
-                else
-                {
-                    // Note released or looping stopped - normal envelope behavior
-                    modEnv2Level = modEnvelope2.getNextSample();
-                }
-                break;
+            envelope.reset();
+            voiceFilter.reset();
+            voiceFilter2.reset();
+            sideFilter.reset();
+            sideFilter2.reset();
+            dcBlocker.reset();
+            sideDcBlocker.reset();
+            voiceFinished = true;
         }
+    }
+
+    if (voiceFinished)
+        clearCurrentNote();
+
+    return voiceFinished ? numRendered : numSamples;
+}
+
+int FreOscVoice::renderModulationStage(int numSamples, bool& voiceFinished)
+{
+    // Work out which per-sample destinations are live for this sub-block
+    blockModulation.hasPitchModulation = params->routing.isDestinationModulated(FreOscModulationRouting::Pitch);
+    blockModulation.hasVolumeModulation = params->routing.isDestinationModulated(FreOscModulationRouting::Volume);
+    blockModulation.hasPanModulation = params->routing.isDestinationModulated(FreOscModulationRouting::Pan);
+    blockModulation.hasCutoffModulation = params->routing.isDestinationModulated(FreOscModulationRouting::Cutoff);
+    blockModulation.hasCutoff2Modulation = params->routing.isDestinationModulated(FreOscModulationRouting::Cutoff2);
+
+    const int controlInterval = juce::jlimit(1, maxSubBlockSize, params->controlRateDivisor);
+    const float ccVolumeModulation = ccVolume * ccExpression;
+
+    auto* gain = scratch.getWritePointer(GainBuffer);
+    float* destinations[FreOscModulationRouting::NumDestinations] = {};
+    destinations[FreOscModulationRouting::Pitch]   = scratch.getWritePointer(PitchModBuffer);
+    destinations[FreOscModulationRouting::Cutoff]  = scratch.getWritePointer(Cutoff1Buffer);
+    destinations[FreOscModulationRouting::Cutoff2] = scratch.getWritePointer(Cutoff2Buffer);
+    destinations[FreOscModulationRouting::Volume]  = scratch.getWritePointer(VolumeModBuffer);
+    destinations[FreOscModulationRouting::Pan]     = scratch.getWritePointer(PanBuffer);
+    destinations[FreOscModulationRouting::PMIndex] = scratch.getWritePointer(PMIndexBuffer);
+    destinations[FreOscModulationRouting::PMRatio] = scratch.getWritePointer(PMRatioBuffer);
+
+    for (int sample = 0; sample < numSamples; ++sample)
+    {
+        // Get envelope level (the amplitude envelope always runs at audio rate).
+        // getNextSample() floors the level at 0.001 to prevent pops; the release
+        // tail uses the unfloored level so it fades out and the voice can be retired
+        float envelopeLevel = envelope.getNextSample();
+        if (envelope.getCurrentPhase() == FreOscEnvelope::Release)
+            envelopeLevel = envelope.getCurrentLevel();
 
         // Get amplitude ramp value for anti-pop
         float amplitudeRampValue = amplitudeRamp.getNextValue();
@@ -422,482 +370,682 @@ void FreOscVoice::renderNextBlock(juce::AudioBuffer<float>& outputBuffer, int st
         // If we're ramping down and reached zero, clear the note
         if (isRampingDown && amplitudeRampValue <= 0.001f)
         {
-            clearCurrentNote();
             envelope.reset(); // Ensure envelope is fully reset
-            break;
+            voiceFinished = true;
+            return sample;
         }
         
         // If envelope is finished, clear the note
         if (!envelope.isActive())
         {
-            clearCurrentNote();
-            break;
+            voiceFinished = true;
+            return sample;
         }
 
-        // Apply modulation envelope modulation
-        float modEnv1Mod = 0.0f, modEnv2Mod = 0.0f;
-        if (params.modEnv1Amount > 0.0f && params.modEnv1Target > 0)
+        // Evaluate LFOs and mod envelopes at control rate, then ramp towards the new targets
+        if (controlRate.samplesRemaining <= 0)
         {
-            modEnv1Mod = modEnv1Level * params.modEnv1Amount;
+            updateControlRateTargets(controlInterval);
+            controlRate.samplesRemaining = controlInterval;
         }
-        if (params.modEnv2Amount > 0.0f && params.modEnv2Target > 0)
+        --controlRate.samplesRemaining;
+
+        for (int destination = 0; destination < FreOscModulationRouting::NumDestinations; ++destination)
         {
-            modEnv2Mod = modEnv2Level * params.modEnv2Amount;
+            controlRate.current[destination] += controlRate.increment[destination];
+            destinations[destination][sample] = controlRate.current[destination];
         }
 
-        // Generate oscillator samples
-        float osc1Sample = 0.0f, osc2Sample = 0.0f, osc3Sample = 0.0f;
-        float noiseSample = 0.0f;
+        gain[sample] = envelopeLevel * currentVelocity * ccVolumeModulation * amplitudeRampValue;
+    }
 
-        // Get LFO values for this sample if LFOs are active
-        float lfoValue = 0.0f;
-        if (params.lfoAmount > 0.0f && params.lfoTarget > 0) // Check both amount and target are set (target > 0 means not "None")
-        {
-            // Set LFO amount (required for internal activity check)
-            lfo.setAmount(params.lfoAmount);
-            
-            // Get the raw LFO signal and apply amount scaling
-            lfoValue = lfo.getNextSample(
-                static_cast<FreOscLFO::Waveform>(params.lfoWaveform.load()),
-                params.lfoRate,
-                static_cast<FreOscLFO::Target>(params.lfoTarget.load())
-            );
-            // LFO value is raw oscillator signal (-1 to +1), apply amount scaling
-            lfoValue *= params.lfoAmount;
-        }
+    return numSamples;
+}
 
-        // Get LFO 2 value for this sample if LFO 2 is active
-        float lfo2Value = 0.0f;
-        if (params.lfo2Amount > 0.0f && params.lfo2Target > 0) // Check both amount and target are set (target > 0 means not "None")
-        {
-            // Set LFO 2 amount (required for internal activity check)
-            lfo2.setAmount(params.lfo2Amount);
-            
-            // Get the raw LFO 2 signal and apply amount scaling
-            lfo2Value = lfo2.getNextSample(
-                static_cast<FreOscLFO::Waveform>(params.lfo2Waveform.load()),
-                params.lfo2Rate,
-                static_cast<FreOscLFO::Target>(params.lfo2Target.load())
-            );
-            // LFO value is raw oscillator signal (-1 to +1), apply amount scaling
-            lfo2Value *= params.lfo2Amount;
-        }
+void FreOscVoice::updateControlRateTargets(int numSamples)
+{
+    // Get modulation envelope levels with mode-specific processing
+    float modEnv1Level = advanceModEnvelope(modEnvelope1, modEnv1State, params->modEnv1Mode, params->modEnv1Rate, numSamples);
+    float modEnv2Level = advanceModEnvelope(modEnvelope2, modEnv2State, params->modEnv2Mode, params->modEnv2Rate, numSamples);
+
+    // Source values for this control step - LFOs only run when something is routed from them
+    float sources[FreOscModulationRouting::NumSources] = {};
+    sources[FreOscModulationRouting::ModEnv1] = modEnv1Level;
+    sources[FreOscModulationRouting::ModEnv2] = modEnv2Level;
+
+    if (params->routing.isSourceUsed(FreOscModulationRouting::LFO1))
+        sources[FreOscModulationRouting::LFO1] = getLFOValue(lfo, params->lfoWaveform, params->lfoRate, params->lfoTarget, params->lfoAmount, numSamples);
+
+    if (params->routing.isSourceUsed(FreOscModulationRouting::LFO2))
+        sources[FreOscModulationRouting::LFO2] = getLFOValue(lfo2, params->lfo2Waveform, params->lfo2Rate, params->lfo2Target, params->lfo2Amount, numSamples);
+
+    if (params->routing.isSourceUsed(FreOscModulationRouting::LFO3))
+        sources[FreOscModulationRouting::LFO3] = getLFOValue(lfo3, params->lfo3Waveform, params->lfo3Rate, params->lfo3Target, params->lfo3Amount, numSamples);
+
+    // Unmodulated destination values
+    float targets[FreOscModulationRouting::NumDestinations];
+    targets[FreOscModulationRouting::Pitch]   = 0.0f;
+    targets[FreOscModulationRouting::Cutoff]  = params->filterCutoff;
+    targets[FreOscModulationRouting::Cutoff2] = params->filter2Cutoff;
+    targets[FreOscModulationRouting::Volume]  = 1.0f;
+    targets[FreOscModulationRouting::Pan]     = 0.0f;
+    targets[FreOscModulationRouting::PMIndex] = params->pmIndex;
+    targets[FreOscModulationRouting::PMRatio] = params->pmRatio;
+
+    // Walk the active routes only (amounts are already folded into the route scale)
+    for (int i = 0; i < params->routing.getNumRoutes(); ++i)
+    {
+        const auto& route = params->routing.getRoute(i);
+        const float value = sources[route.source] * route.scale;
+        float& target = targets[route.destination];
 
-        // Get LFO 3 value for this sample if LFO 3 is active
-        float lfo3Value = 0.0f;
-        if (params.lfo3Amount > 0.0f && params.lfo3Target > 0) // Check both amount and target are set (target > 0 means not "None")
-        {
-            // Set LFO 3 amount (required for internal activity check)
-            lfo3.setAmount(params.lfo3Amount);
-            
-            // Get the raw LFO 3 signal and apply amount scaling
-            lfo3Value = lfo3.getNextSample(
-                static_cast<FreOscLFO::Waveform>(params.lfo3Waveform.load()),
-                params.lfo3Rate,
-                static_cast<FreOscLFO::Target>(params.lfo3Target.load())
-            );
-            // LFO value is raw oscillator signal (-1 to +1), apply amount scaling
-            lfo3Value *= params.lfo3Amount;
-        }
+        if (route.destination == FreOscModulationRouting::Volume)
+            target *= 1.0f + value;
+        else
+            target += value;
 
-        // Apply modulation envelope modulation to parameters
-        float modulatedPMIndex = params.pmIndex;
-        float modulatedPMRatio = params.pmRatio;
-        float modulatedFilterCutoff = params.filterCutoff;
-        float modulatedFilter2Cutoff = params.filter2Cutoff;
-        
-        // Apply ModEnv1 modulation based on target
-        if (params.modEnv1Amount > 0.0f && params.modEnv1Target > 0)
-        {
-            switch (params.modEnv1Target.load())
-            {
-                case 1: modulatedPMIndex = juce::jlimit(0.0f, 10.0f, modulatedPMIndex + (modEnv1Mod * 5.0f)); break; // PM Index
-                case 2: modulatedPMRatio = juce::jlimit(0.1f, 8.0f, modulatedPMRatio + (modEnv1Mod * 4.0f)); break; // PM Ratio
-                case 3: modulatedFilterCutoff = juce::jlimit(0.0f, 1.0f, modulatedFilterCutoff + modEnv1Mod); break; // Filter Cutoff
-                case 4: modulatedFilter2Cutoff = juce::jlimit(0.0f, 1.0f, modulatedFilter2Cutoff + modEnv1Mod); break; // Filter2 Cutoff
-            }
-        }
-        
-        // Apply ModEnv2 modulation based on target
-        if (params.modEnv2Amount > 0.0f && params.modEnv2Target > 0)
-        {
-            switch (params.modEnv2Target.load())
-            {
-                case 1: modulatedPMIndex = juce::jlimit(0.0f, 10.0f, modulatedPMIndex + (modEnv2Mod * 5.0f)); break; // PM Index
-                case 2: modulatedPMRatio = juce::jlimit(0.1f, 8.0f, modulatedPMRatio + (modEnv2Mod * 4.0f)); break; // PM Ratio
-                case 3: modulatedFilterCutoff = juce::jlimit(0.0f, 1.0f, modulatedFilterCutoff + modEnv2Mod); break; // Filter Cutoff
-                case 4: modulatedFilter2Cutoff = juce::jlimit(0.0f, 1.0f, modulatedFilter2Cutoff + modEnv2Mod); break; // Filter2 Cutoff
-            }
-        }
+        if (route.clampAfter)
+            target = FreOscModulationRouting::clampDestination(route.destination, target);
+    }
 
-        // Apply LFO modulation to PM parameters (additive from all active LFOs)
-        float pmIndexModulation = 0.0f;
-        float pmRatioModulation = 0.0f;
-        
-        // LFO 1 modulation
-        if (params.lfoAmount > 0.0f && params.lfoTarget == 6) // PM Index target
-            pmIndexModulation += lfoValue * 5.0f;
-        if (params.lfoAmount > 0.0f && params.lfoTarget == 7) // PM Ratio target
-            pmRatioModulation += lfoValue * 4.0f;
-            
-        // LFO 2 modulation
-        if (params.lfo2Amount > 0.0f && params.lfo2Target == 6) // PM Index target
-            pmIndexModulation += lfo2Value * 5.0f;
-        if (params.lfo2Amount > 0.0f && params.lfo2Target == 7) // PM Ratio target
-            pmRatioModulation += lfo2Value * 4.0f;
-            
-        // LFO 3 modulation
-        if (params.lfo3Amount > 0.0f && params.lfo3Target == 6) // PM Index target
-            pmIndexModulation += lfo3Value * 5.0f;
-        if (params.lfo3Amount > 0.0f && params.lfo3Target == 7) // PM Ratio target
-            pmRatioModulation += lfo3Value * 4.0f;
-            
-        // Apply modulation with limits
-        modulatedPMIndex = juce::jlimit(0.0f, 10.0f, modulatedPMIndex + pmIndexModulation);
-        modulatedPMRatio = juce::jlimit(0.1f, 8.0f, modulatedPMRatio + pmRatioModulation);
+    for (int destination = 0; destination < FreOscModulationRouting::NumDestinations; ++destination)
+        targets[destination] = FreOscModulationRouting::clampDestination(static_cast<FreOscModulationRouting::Destination>(destination), targets[destination]);
 
-        // Apply pitch modulation from all active LFOs (10% of fundamental frequency)
-        float pitchModulation = 0.0f;
-        bool hasPitchModulation = false;
-        
-        // Check LFO 1 pitch modulation
-        if (params.lfoAmount > 0.0f && params.lfoTarget == 1) // Pitch target
+    // Linear ramp from the current values to the new targets across the control interval.
+    // A fresh note jumps straight to its targets instead of ramping from the last note.
+    for (int destination = 0; destination < FreOscModulationRouting::NumDestinations; ++destination)
+    {
+        if (controlRate.needsReset)
         {
-            pitchModulation += lfoValue * 0.1f; // lfoValue already includes amount scaling
-            hasPitchModulation = true;
+            controlRate.current[destination] = targets[destination];
+            controlRate.increment[destination] = 0.0f;
         }
-        
-        // Check LFO 2 pitch modulation
-        if (params.lfo2Amount > 0.0f && params.lfo2Target == 1) // Pitch target
+        else
         {
-            pitchModulation += lfo2Value * 0.1f; // lfo2Value already includes amount scaling
-            hasPitchModulation = true;
+            controlRate.increment[destination] = (targets[destination] - controlRate.current[destination]) / static_cast<float>(numSamples);
         }
+    }
+
+    controlRate.needsReset = false;
+}
+
+float FreOscVoice::getLFOValue(FreOscLFO& source, int waveform, float rate, int target, float amount, int numSamples)
+{
+    // Set LFO amount (required for internal activity check)
+    source.setAmount(amount);
+
+    // Raw LFO signal (-1 to +1); the route scale applies the amount
+    return source.getNextSample(
+        static_cast<FreOscLFO::Waveform>(waveform),
+        rate,
+        static_cast<FreOscLFO::Target>(target),
+        numSamples
+    );
+}
+
+float FreOscVoice::advanceModEnvelope(FreOscEnvelope& modEnvelope, ModEnvState& state, int currentMode, float rate, int numSamples)
+{
+    float modEnvLevel = 0.0f;
+
+    // Check for mode changes and reset state if needed
+    if (currentMode != state.lastMode)
+    {
+        // Mode changed - reset envelope state
+        state.oneShotCompleted = false;
+        state.isLooping = (currentMode == 2);
+        state.loopingActive = (currentMode == 2) && noteIsOn;
+        state.lastMode = currentMode;
         
-        // Check LFO 3 pitch modulation
-        if (params.lfo3Amount > 0.0f && params.lfo3Target == 1) // Pitch target
+        // Reset rate-based timing
+        state.currentCycleSample = 0;
+        state.cycleActive = (currentMode == 0 || currentMode == 2) && noteIsOn;
+        if (state.cycleActive)
         {
-            pitchModulation += lfo3Value * 0.1f; // lfo3Value already includes amount scaling
-            hasPitchModulation = true;
+            state.cycleSamples = currentSampleRate / juce::jmax(0.1f, rate);
         }
         
-        // Generate PM modulation signal using dedicated PM modulator
-        float pmSignal = 0.0f;
-        bool hasPM = (modulatedPMIndex > 0.0f);
-        
-        if (hasPM)
-        {
-            // Sync PM modulator with OSC3's waveform settings
-            syncPMModulatorWithOSC3();
-            
-            // Set PM modulator frequency to note * ratio (independent of OSC3's frequency)
-            float modulatorFreq = currentNoteFrequency * modulatedPMRatio;
-            pmModulator.setFrequency(modulatorFreq);
-            
-            // Apply LFO pitch modulation to PM modulator if active
-            if (hasPitchModulation)
-                pmModulator.setFrequencyModulation(pitchModulation);
-            else
-                pmModulator.setFrequencyModulation(0.0f);
+        // Restart envelope if note is active
+        if (noteIsOn)
+            modEnvelope.noteOn();
+    }
+    
+    // Process the envelope based on current mode
+    switch (currentMode)
+    {
+        case 0: // One-Shot mode (rate-based timing)
+            if (state.cycleActive && !state.oneShotCompleted)
+            {
+                state.currentCycleSample += numSamples;
                 
-            // Generate PM modulation signal (uses OSC3's waveform but separate processing)
-            float pmModulatorOutput = pmModulator.processRawSample(0.0f);
-            pmSignal = pmModulatorOutput * modulatedPMIndex * 0.3f; // PM intensity controlled by Index only
-        }
-        
-        // Process OSC3 normally for audio output (unaffected by PM)
-        if (params.osc3Level > 0.0f && oscillator3.getCurrentLevel() > 0.0f)
-        {
-            // Apply LFO pitch modulation to OSC3 if active
-            if (hasPitchModulation)
-                oscillator3.setFrequencyModulation(pitchModulation);
-            else
-                oscillator3.setFrequencyModulation(0.0f);
+                // Check if cycle is complete
+                if (state.currentCycleSample >= state.cycleSamples)
+                {
+                    state.oneShotCompleted = true;
+                    state.cycleActive = false;
+                    modEnvelope.noteOff(); // Start release phase
+                }
                 
-            // OSC3 audio uses normal processing at its own frequency settings
-            osc3Sample = oscillator3.processSample(0.0f);
-        }
-
-        // Generate samples from active oscillators with proper FM routing
-        if (params.osc1Level > 0.0f && oscillator1.getCurrentLevel() > 0.0f)
-        {
-            // Apply LFO pitch modulation if active
-            if (hasPitchModulation)
-                oscillator1.setFrequencyModulation(pitchModulation);
-            else
-                oscillator1.setFrequencyModulation(0.0f);
+                modEnvLevel = modEnvelope.advance(numSamples);
                 
-            // Apply PM modulation if this oscillator is a carrier
-            float pmInput = 0.0f;
-            if (shouldReceivePM(1) && pmSignal != 0.0f)
+                // Restart envelope if it finishes before cycle time
+                if (!modEnvelope.isActive() && state.cycleActive)
+                {
+                    modEnvelope.reset();
+                    modEnvelope.noteOn();
+                }
+            }
+            else if (!state.oneShotCompleted)
             {
-                pmInput = pmSignal;
+                modEnvLevel = modEnvelope.advance(numSamples);
             }
+            // Once completed, envelope stays at 0
+            break;
             
-            osc1Sample = oscillator1.processSample(pmInput);
-        }
-
-        if (params.osc2Level > 0.0f && oscillator2.getCurrentLevel() > 0.0f)
-        {
-            // Apply LFO pitch modulation if active
-            if (hasPitchModulation)
-                oscillator2.setFrequencyModulation(pitchModulation);
-            else
-                oscillator2.setFrequencyModulation(0.0f);
+        case 1: // Gate mode (standard ADSR, ignores rate)
+            modEnvLevel = modEnvelope.advance(numSamples);
+            break;
+            
+        case 2: // Looping mode (rate-based timing)
+            if (state.cycleActive && noteIsOn)
+            {
+                state.currentCycleSample += numSamples;
+                
+                // Check if cycle is complete - restart immediately
+                if (state.currentCycleSample >= state.cycleSamples)
+                {
+                    state.currentCycleSample = 0;
+                    modEnvelope.reset();
+                    modEnvelope.noteOn();
+                }
                 
-            // Apply PM modulation if this oscillator is a carrier
-            float pmInput = 0.0f;
-            if (shouldReceivePM(2) && pmSignal != 0.0f)
+                modEnvLevel = modEnvelope.advance(numSamples);
+            }
+            else
             {
-                pmInput = pmSignal;
+                // Note released or looping stopped - normal envelope behavior
+                modEnvLevel = modEnvelope.advance(numSamples);
             }
-            osc2Sample = oscillator2.processSample(pmInput);
-        }
+            break;
+    }
+
+    return modEnvLevel;
+}
 
-        // OSC3 was processed above independently of PM
+void FreOscVoice::renderSourceStage(int numSamples)
+{
+    auto* mix = scratch.getWritePointer(MixBuffer);
+    const auto* pitchMod = blockModulation.hasPitchModulation ? scratch.getReadPointer(PitchModBuffer) : nullptr;
+    const auto* pmIndex = scratch.getReadPointer(PMIndexBuffer);
+    auto* pmRatio = scratch.getWritePointer(PMRatioBuffer);
+    auto* pmSignal = scratch.getWritePointer(PMSignalBuffer);
+
+    juce::FloatVectorOperations::clear(mix, numSamples);
+
+    // Stereo unison renders a side signal next to the mono mix
+    blockModulation.hasSideSignal = (params->osc1Level > 0.0f && oscillator1.hasStereoUnison())
+                                 || (params->osc2Level > 0.0f && oscillator2.hasStereoUnison())
+                                 || (params->osc3Level > 0.0f && oscillator3.hasStereoUnison());
+
+    auto* side = blockModulation.hasSideSignal ? scratch.getWritePointer(SideBuffer) : nullptr;
+    if (side != nullptr)
+        juce::FloatVectorOperations::clear(side, numSamples);
+
+    // Generate PM modulation signal using dedicated PM modulator
+    bool hasPM = false;
+    for (int sample = 0; sample < numSamples && !hasPM; ++sample)
+        hasPM = pmIndex[sample] > 0.0f;
+
+    // A high PM index renders the modulator and its carriers oversampled instead. The
+    // factor is fixed for the note, so the carriers stay on the oversampled path (and
+    // in the decimator delay) even while the index is modulated down to zero
+    const bool pmOversampled = pmOversamplingFactor > 1;
+
+    if (hasPM && !pmOversampled)
+    {
+        FREOSC_PROFILE_STAGE(profilingStats, VoicePM);
 
-        // Generate noise if active
-        if (params.noiseLevel > 0.0f)
-        {
-            noiseSample = noiseGenerator.processSample();
-        }
+        // Sync PM modulator with OSC3's waveform settings (these only change between blocks)
+        syncPMModulatorWithOSC3();
+        const float baseRatio = tunePMModulator(pmRatio[0]);
 
-        // Apply volume modulation from all active LFOs
-        float volumeModulation = 1.0f;
-        
-        // Check LFO 1 volume modulation
-        if (params.lfoAmount > 0.0f && params.lfoTarget == 4) // Volume target
-        {
-            volumeModulation *= 1.0f + (lfoValue * 0.5f); // lfoValue already includes amount scaling
-        }
-        
-        // Check LFO 2 volume modulation
-        if (params.lfo2Amount > 0.0f && params.lfo2Target == 4) // Volume target
-        {
-            volumeModulation *= 1.0f + (lfo2Value * 0.5f); // lfo2Value already includes amount scaling
-        }
-        
-        // Check LFO 3 volume modulation
-        if (params.lfo3Amount > 0.0f && params.lfo3Target == 4) // Volume target
+        // Ratio changes across the block and LFO pitch modulation become one
+        // per-sample pitch modulation (converted in place)
+        auto* pmPitch = pmRatio;
+        for (int sample = 0; sample < numSamples; ++sample)
         {
-            volumeModulation *= 1.0f + (lfo3Value * 0.5f); // lfo3Value already includes amount scaling
+            const float pitch = pitchMod != nullptr ? pitchMod[sample] : 0.0f;
+            pmPitch[sample] = (pmRatio[sample] / baseRatio) * (1.0f + pitch) - 1.0f;
         }
-        
-        volumeModulation = juce::jmax(0.0f, volumeModulation); // Prevent negative volume
 
-        // Mix all sources
-        float mixedSample = (osc1Sample + osc2Sample + osc3Sample + noiseSample) * volumeModulation;
+        // Generate PM modulation signal (uses OSC3's waveform but separate processing)
+        pmModulator.renderRawBlock(pmSignal, numSamples, nullptr, pmPitch);
 
-        // Safety check: prevent NaN/infinity values that could cause crackling
-        if (!std::isfinite(mixedSample))
-            mixedSample = 0.0f;
+        // PM intensity controlled by Index only
+        juce::FloatVectorOperations::multiply(pmSignal, pmIndex, numSamples);
+        juce::FloatVectorOperations::multiply(pmSignal, 0.3f, numSamples);
+    }
 
-        // Apply envelope and CC volume/expression modulation
-        float ccVolumeModulation = ccVolume * ccExpression;
+    {
+        FREOSC_PROFILE_STAGE(profilingStats, VoiceOscillators);
 
-        // Add modulation wheel effect on LFO amount
-        // float effectiveLfoAmount = params.lfoAmount;
-        // if (ccModWheel > 0.0f)
-        // {
-        //     effectiveLfoAmount += ccModWheel * 0.5f; // Mod wheel can add up to 50% more LFO
-        // }
+        // Process OSC3 normally for audio output (unaffected by PM)
+        renderOscillator(oscillator3, params->osc3Level, mix, side, pitchMod, nullptr, numSamples);
+
+        // Generate samples from active oscillators with proper PM routing
+        // (oversampled PM carriers are mixed in last)
+        if (!(pmOversampled && shouldReceivePM(1)))
+            renderOscillator(oscillator1, params->osc1Level, mix, side, pitchMod, (hasPM && shouldReceivePM(1)) ? pmSignal : nullptr, numSamples);
+        if (!(pmOversampled && shouldReceivePM(2)))
+            renderOscillator(oscillator2, params->osc2Level, mix, side, pitchMod, (hasPM && shouldReceivePM(2)) ? pmSignal : nullptr, numSamples);
+    }
 
-        // Apply minimum envelope level to prevent pops when envelope reaches 0
-        float safeEnvelopeLevel = juce::jmax(envelopeLevel, 0.001f);
-        mixedSample *= safeEnvelopeLevel * currentVelocity * ccVolumeModulation * amplitudeRampValue;
+    // Six operator FM engine (LFO pitch modulation applies to every operator)
+    if (params->fmLevel > 0.0f)
+    {
+        FREOSC_PROFILE_STAGE(profilingStats, VoiceFM);
+        fmEngine.renderBlock(mix, numSamples, params->fmLevel, pitchMod);
+    }
 
-        // Apply per-voice filtering (after envelope, before panning)
-        // Check for LFO filter modulation from all active LFOs
-        float filterModulation = 0.0f;
-        
-        // Check LFO 1 filter modulation
-        if (params.lfoAmount > 0.0f && params.lfoTarget == 2) // Filter target
-        {
-            filterModulation += lfoValue * 0.3f; // ±30% modulation range
-        }
-        
-        // Check LFO 2 filter modulation
-        if (params.lfo2Amount > 0.0f && params.lfo2Target == 2) // Filter target
-        {
-            filterModulation += lfo2Value * 0.3f; // ±30% modulation range
-        }
-        
-        // Check LFO 3 filter modulation
-        if (params.lfo3Amount > 0.0f && params.lfo3Target == 2) // Filter target
-        {
-            filterModulation += lfo3Value * 0.3f; // ±30% modulation range
-        }
+    // Generate noise if active
+    if (params->noiseLevel > 0.0f)
+    {
+        FREOSC_PROFILE_STAGE(profilingStats, VoiceNoise);
 
-        // Apply filter modulation to cutoff (starting from mod envelope modulated value)
-        float finalModulatedCutoff = modulatedFilterCutoff + filterModulation;
-        finalModulatedCutoff = juce::jlimit(0.0f, 1.0f, finalModulatedCutoff);
+        for (int sample = 0; sample < numSamples; ++sample)
+            mix[sample] += noiseGenerator.processSample();
+    }
 
-        // Check for LFO filter 2 modulation from all active LFOs
-        float filter2Modulation = 0.0f;
-        
-        // Check LFO 1 filter2 modulation
-        if (params.lfoAmount > 0.0f && params.lfoTarget == 3) // Filter2 target
+    // Oversampled PM carriers leave the decimators late, so everything rendered at the
+    // voice rate is delayed by the same amount before they are mixed in
+    if (pmOversampled)
+    {
+        FREOSC_PROFILE_STAGE(profilingStats, VoicePM);
+        alignWithOversampledPM(mix, side, numSamples);
+        renderOversampledPM(mix, side, pitchMod, numSamples);
+    }
+}
+
+void FreOscVoice::renderOscillator(FreOscOscillator& oscillator, float paramLevel, float* destination, float* sideDestination,
+                                   const float* pitchModulation, const float* pmInput, int numSamples)
+{
+    if (paramLevel <= 0.0f || oscillator.getCurrentLevel() <= 0.0f)
+        return;
+
+    // LFO pitch modulation (if active) comes in per sample
+    oscillator.setFrequencyModulation(0.0f);
+    oscillator.renderStereoBlock(destination, sideDestination, numSamples, pmInput, pitchModulation);
+}
+
+void FreOscVoice::startPMOversampling()
+{
+    static constexpr int factors[] = { 1, 2, maxPMOversampling };
+    const int requested = factors[juce::jlimit(0, 2, params->pmOversampling)];
+
+    // Decided once per note from the highest index the patch can reach (base index plus
+    // every PM index route at full swing). Switching mid-note would hop the carriers in
+    // and out of the decimator delay and restart the filter history, which clicks.
+    float peakIndex = params->pmIndex;
+    const auto& routing = params->routing;
+    for (int i = 0; i < routing.getNumRoutes(); ++i)
+        if (routing.getRoute(i).destination == FreOscModulationRouting::PMIndex)
+            peakIndex += std::abs(routing.getRoute(i).scale);
+
+    peakIndex = FreOscModulationRouting::clampDestination(FreOscModulationRouting::PMIndex, peakIndex);
+
+    const bool hasCarrier = shouldReceivePM(1) || shouldReceivePM(2);
+    pmOversamplingFactor = (hasCarrier && peakIndex > pmOversamplingIndexThreshold) ? requested : 1;
+
+    for (auto& chain : pmDecimators)
+        for (auto& stage : chain)
+            stage.reset();
+
+    // Decimator latency in voice samples - each stage delays by outputDelay at its output rate
+    pmAlignmentDelaySamples = 0;
+    for (int factor = pmOversamplingFactor; factor > 1; factor /= 2)
+        pmAlignmentDelaySamples += FreOscHalfBandDecimator::outputDelay * 2 / factor;
+
+    pmAlignmentDelayPosition = 0;
+    for (auto& history : pmAlignmentDelay)
+        std::fill(std::begin(history), std::end(history), 0.0f);
+}
+
+void FreOscVoice::alignWithOversampledPM(float* mix, float* side, int numSamples)
+{
+    const int delay = pmAlignmentDelaySamples;
+    float* channels[] = { mix, side };
+
+    for (int channel = 0; channel < 2; ++channel)
+    {
+        auto* history = pmAlignmentDelay[channel];
+
+        // Without a side signal this block, its delay line restarts from silence
+        if (channels[channel] == nullptr)
         {
-            filter2Modulation += lfoValue * 0.3f; // ±30% modulation range
+            std::fill(history, history + delay, 0.0f);
+            continue;
         }
-        
-        // Check LFO 2 filter2 modulation
-        if (params.lfo2Amount > 0.0f && params.lfo2Target == 3) // Filter2 target
+
+        auto* samples = channels[channel];
+        int position = pmAlignmentDelayPosition;
+
+        for (int sample = 0; sample < numSamples; ++sample)
         {
-            filter2Modulation += lfo2Value * 0.3f; // ±30% modulation range
+            const float delayed = history[position];
+            history[position] = samples[sample];
+            samples[sample] = delayed;
+
+            if (++position == delay)
+                position = 0;
         }
-        
-        // Check LFO 3 filter2 modulation
-        if (params.lfo3Amount > 0.0f && params.lfo3Target == 3) // Filter2 target
+    }
+
+    pmAlignmentDelayPosition = (pmAlignmentDelayPosition + numSamples) % delay;
+}
+
+void FreOscVoice::renderOversampledPM(float* mix, float* side, const float* pitchModulation, int numSamples)
+{
+    const int factor = pmOversamplingFactor;
+    const int numOversampled = numSamples * factor;
+    const float rateScale = 1.0f / static_cast<float>(factor);
+
+    const auto* pmIndex = scratch.getReadPointer(PMIndexBuffer);
+    const auto* pmRatio = scratch.getReadPointer(PMRatioBuffer);
+
+    auto* carrierPitch = oversampledScratch.getWritePointer(OversampledCarrierPitch);
+    auto* modulatorPitch = oversampledScratch.getWritePointer(OversampledModulatorPitch);
+    auto* pmDepth = oversampledScratch.getWritePointer(OversampledPMDepth);
+    auto* pmSignal = oversampledScratch.getWritePointer(OversampledPMSignal);
+    auto* carrierMix = oversampledScratch.getWritePointer(OversampledMix);
+    auto* carrierSide = side != nullptr ? oversampledScratch.getWritePointer(OversampledSide) : nullptr;
+
+    syncPMModulatorWithOSC3();
+    const float baseRatio = tunePMModulator(pmRatio[0]);
+
+    // Control signals are held across the oversampled steps. The rate change is folded
+    // into the pitch modulation, so the oscillators keep their voice-rate tuning and phase
+    for (int sample = 0; sample < numSamples; ++sample)
+    {
+        const float pitch = (1.0f + (pitchModulation != nullptr ? pitchModulation[sample] : 0.0f)) * rateScale;
+        const float carrier = pitch - 1.0f;
+        const float modulator = (pmRatio[sample] / baseRatio) * pitch - 1.0f;
+        const float depth = pmIndex[sample] * 0.3f;
+
+        for (int step = sample * factor; step < (sample + 1) * factor; ++step)
         {
-            filter2Modulation += lfo3Value * 0.3f; // ±30% modulation range
+            carrierPitch[step] = carrier;
+            modulatorPitch[step] = modulator;
+            pmDepth[step] = depth;
         }
+    }
+
+    pmModulator.renderRawBlock(pmSignal, numOversampled, nullptr, modulatorPitch);
+    juce::FloatVectorOperations::multiply(pmSignal, pmDepth, numOversampled);
+
+    juce::FloatVectorOperations::clear(carrierMix, numOversampled);
+    if (carrierSide != nullptr)
+        juce::FloatVectorOperations::clear(carrierSide, numOversampled);
+
+    if (shouldReceivePM(1))
+        renderOscillator(oscillator1, params->osc1Level, carrierMix, carrierSide, carrierPitch, pmSignal, numOversampled);
+    if (shouldReceivePM(2))
+        renderOscillator(oscillator2, params->osc2Level, carrierMix, carrierSide, carrierPitch, pmSignal, numOversampled);
+
+    // Back to the voice rate through the half-band cascade (in place)
+    auto decimate = [&](float* samples, FreOscHalfBandDecimator* stages)
+    {
+        for (int length = numOversampled; length > numSamples; length /= 2)
+            (stages++)->process(samples, samples, length);
+    };
+
+    decimate(carrierMix, pmDecimators[0]);
+    juce::FloatVectorOperations::add(mix, carrierMix, numSamples);
+
+    if (carrierSide != nullptr)
+    {
+        decimate(carrierSide, pmDecimators[1]);
+        juce::FloatVectorOperations::add(side, carrierSide, numSamples);
+    }
+}
+
+void FreOscVoice::renderFilterStage(int numSamples)
+{
+    // Coefficients the processor designed for every voice; a filter only designs its own
+    // while its cutoff is modulated
+    for (auto* filter : { &voiceFilter, &sideFilter })
+        filter->setSharedCoefficients(&params->filterCoefficients);
 
-        // Apply filter2 modulation to cutoff (starting from mod envelope modulated value)
-        float finalModulatedCutoff2 = modulatedFilter2Cutoff + filter2Modulation;
-        finalModulatedCutoff2 = juce::jlimit(0.0f, 1.0f, finalModulatedCutoff2);
+    for (auto* filter : { &voiceFilter2, &sideFilter2 })
+        filter->setSharedCoefficients(&params->filter2Coefficients);
+
+    renderFilterChannel(scratch.getWritePointer(MixBuffer), scratch.getWritePointer(Filter2Buffer),
+                        voiceFilter, voiceFilter2, numSamples);
+
+    if (blockModulation.hasSideSignal)
+        renderFilterChannel(scratch.getWritePointer(SideBuffer), scratch.getWritePointer(SideFilter2Buffer),
+                            sideFilter, sideFilter2, numSamples);
+}
 
-        // Update filter if modulation changed or mod envelope is active
-        if (std::abs(filterModulation) > 0.001f || std::abs(finalModulatedCutoff - params.filterCutoff.load()) > 1e-6f)
+void FreOscVoice::renderFilterChannel(float* samples, float* parallelScratch, FreOscFilter& filter1, FreOscFilter& filter2, int numSamples)
+{
+    const auto* cutoff1 = scratch.getReadPointer(Cutoff1Buffer);
+    const auto* cutoff2 = scratch.getReadPointer(Cutoff2Buffer);
+
+    auto runFilter1 = [&](float* channel)
+    {
+        if (blockModulation.hasCutoffModulation)
         {
-            voiceFilter.setCutoffFrequency(finalModulatedCutoff);
+            filter1.processBlockWithCutoff(channel, cutoff1, numSamples);
         }
-        
-        // Update filter2 if modulation changed or mod envelope is active
-        if (std::abs(filter2Modulation) > 0.001f || std::abs(finalModulatedCutoff2 - params.filter2Cutoff.load()) > 1e-6f)
+        else
         {
-            voiceFilter2.setCutoffFrequency(finalModulatedCutoff2);
+            // Back at the base cutoff once modulation stops, so the shared coefficients apply again
+            filter1.setCutoffFrequency(params->filterCutoff);
+            filter1.processBlock(channel, numSamples);
         }
+    };
 
-        // Process sample through dual filter system
-        FilterRouting routing = static_cast<FilterRouting>(params.filterRouting.load());
-        
-        float filteredSample = mixedSample;
-        
-        if (routing == FilterOff)
+    auto runFilter2 = [&](float* channel)
+    {
+        if (blockModulation.hasCutoff2Modulation)
         {
-            // Only Filter 1 processes audio
-            float tempSample = filteredSample;
-            float* samplePtr = &tempSample;
-            juce::dsp::AudioBlock<float> filterBlock(&samplePtr, 1, 1);
-            juce::dsp::ProcessContextReplacing<float> filterContext(filterBlock);
-            voiceFilter.process(filterContext);
-            filteredSample = tempSample;
+            filter2.processBlockWithCutoff(channel, cutoff2, numSamples);
         }
-        else if (routing == FilterParallel)
+        else
         {
-            // Both filters process in parallel, outputs summed
-            float tempSample1 = filteredSample;
-            float tempSample2 = filteredSample;
-            
-            // Process through Filter 1
-            float* samplePtr1 = &tempSample1;
-            juce::dsp::AudioBlock<float> filterBlock1(&samplePtr1, 1, 1);
-            juce::dsp::ProcessContextReplacing<float> filterContext1(filterBlock1);
-            voiceFilter.process(filterContext1);
-            
-            // Process through Filter 2
-            float* samplePtr2 = &tempSample2;
-            juce::dsp::AudioBlock<float> filterBlock2(&samplePtr2, 1, 1);
-            juce::dsp::ProcessContextReplacing<float> filterContext2(filterBlock2);
-            voiceFilter2.process(filterContext2);
-            
-            // Sum the parallel outputs (with 0.5 scaling to prevent clipping)
-            filteredSample = (tempSample1 + tempSample2) * 0.5f;
+            filter2.setCutoffFrequency(params->filter2Cutoff);
+            filter2.processBlock(channel, numSamples);
         }
+    };
+
+    // Process sub-block through dual filter system
+    FilterRouting routing = static_cast<FilterRouting>(params->filterRouting);
+
+    if (routing == FilterOff)
+    {
+        // Only Filter 1 processes audio
+        runFilter1(samples);
+    }
+    else if (!blockModulation.hasCutoffModulation && !blockModulation.hasCutoff2Modulation)
+    {
+        // Neither cutoff moves within the block, so both filters run in one pass
+        filter1.setCutoffFrequency(params->filterCutoff);
+        filter2.setCutoffFrequency(params->filter2Cutoff);
+
+        if (routing == FilterParallel && filter1.sharesTuningWith(filter2))
+            filter1.processParallelWith(filter2, samples, numSamples);  // Same integrators for both outputs
+        else if (routing == FilterParallel)
+            FreOscFilter::processDualParallel(filter1, filter2, samples, numSamples);
         else if (routing == FilterSeries)
-        {
-            // Filter 1 -> Filter 2 in series
-            float tempSample = filteredSample;
-            
-            // Process through Filter 1 first
-            float* samplePtr1 = &tempSample;
-            juce::dsp::AudioBlock<float> filterBlock1(&samplePtr1, 1, 1);
-            juce::dsp::ProcessContextReplacing<float> filterContext1(filterBlock1);
-            voiceFilter.process(filterContext1);
-            
-            // Then process through Filter 2
-            float* samplePtr2 = &tempSample;
-            juce::dsp::AudioBlock<float> filterBlock2(&samplePtr2, 1, 1);
-            juce::dsp::ProcessContextReplacing<float> filterContext2(filterBlock2);
-            voiceFilter2.process(filterContext2);
-            
-            filteredSample = tempSample;
-        }
-        
-        mixedSample = filteredSample;
+            FreOscFilter::processDualSeries(filter1, filter2, samples, numSamples);
+    }
+    else if (routing == FilterParallel)
+    {
+        // Both filters process in parallel, outputs summed
+        juce::FloatVectorOperations::copy(parallelScratch, samples, numSamples);
+
+        runFilter1(samples);
+        runFilter2(parallelScratch);
 
-        // Scale down for polyphony to prevent clipping when multiple voices play
-        // Very conservative scaling since we fixed the triple-level issue
-        mixedSample *= 0.3f; // Conservative but not too quiet
+        // Sum the parallel outputs (with 0.5 scaling to prevent clipping)
+        juce::FloatVectorOperations::add(samples, parallelScratch, numSamples);
+        juce::FloatVectorOperations::multiply(samples, 0.5f, numSamples);
+    }
+    else if (routing == FilterSeries)
+    {
+        // Filter 1 -> Filter 2 in series
+        runFilter1(samples);
+        runFilter2(samples);
+    }
+}
 
-        // Final safety check after all processing
-        if (!std::isfinite(mixedSample))
-            mixedSample = 0.0f;
+void FreOscVoice::renderOutputStage(juce::AudioBuffer<float>& outputBuffer, int startSample, int numSamples)
+{
+    auto* mix = scratch.getWritePointer(MixBuffer);
 
-        // Apply DC blocking filter to remove any DC offset
-        mixedSample = dcBlocker.processSample(mixedSample);
+    // Scale down for polyphony to prevent clipping when multiple voices play
+    // Very conservative scaling since we fixed the triple-level issue
+    juce::FloatVectorOperations::multiply(mix, 0.3f, numSamples);
 
-        // Soft clipping to prevent harsh distortion
-        mixedSample = juce::jlimit(-1.0f, 1.0f, mixedSample);
+    // Final safety check after all processing
+    sanitiseBuffer(mix, numSamples);
 
-        // Calculate stereo positioning with LFO pan modulation
-        float leftGain = 1.0f, rightGain = 1.0f;
+    // Apply DC blocking filter to remove any DC offset
+    for (int sample = 0; sample < numSamples; ++sample)
+        mix[sample] = dcBlocker.processSample(mix[sample]);
 
-        // Calculate base panning (weighted average based on oscillator levels)
-        float totalLevelForPan = params.osc1Level + params.osc2Level + params.osc3Level;
-        float avgPan = 0.0f;
-        if (totalLevelForPan > 0.0f)
-        {
-            avgPan = (params.osc1Pan * params.osc1Level +
-                     params.osc2Pan * params.osc2Level +
-                     params.osc3Pan * params.osc3Level) / totalLevelForPan;
-        }
+    // Stereo unison: same treatment for the side signal, then mid/side to left/right
+    // (mix becomes the left channel, the side buffer the right)
+    auto* leftSignal = mix;
+    auto* rightSignal = mix;
 
-        // Apply LFO pan modulation from all active LFOs
-        // Check LFO 1 pan modulation
-        if (params.lfoAmount > 0.0f && params.lfoTarget == 5) // Pan target
-        {
-            avgPan += lfoValue; // lfoValue already includes amount scaling
-        }
-        
-        // Check LFO 2 pan modulation  
-        if (params.lfo2Amount > 0.0f && params.lfo2Target == 5) // Pan target
-        {
-            avgPan += lfo2Value; // lfo2Value already includes amount scaling
-        }
-        
-        // Check LFO 3 pan modulation
-        if (params.lfo3Amount > 0.0f && params.lfo3Target == 5) // Pan target
+    if (blockModulation.hasSideSignal)
+    {
+        auto* side = scratch.getWritePointer(SideBuffer);
+
+        juce::FloatVectorOperations::multiply(side, 0.3f, numSamples);
+        sanitiseBuffer(side, numSamples);
+
+        for (int sample = 0; sample < numSamples; ++sample)
+            side[sample] = sideDcBlocker.processSample(side[sample]);
+
+        juce::FloatVectorOperations::add(side, mix, numSamples);                    // mid + side
+        juce::FloatVectorOperations::multiply(mix, 2.0f, numSamples);
+        juce::FloatVectorOperations::subtract(mix, side, numSamples);               // mid - side
+        rightSignal = side;
+    }
+
+    // Soft clipping to prevent harsh distortion
+    juce::FloatVectorOperations::clip(leftSignal, leftSignal, -1.0f, 1.0f, numSamples);
+    if (rightSignal != leftSignal)
+        juce::FloatVectorOperations::clip(rightSignal, rightSignal, -1.0f, 1.0f, numSamples);
+
+    // Track the output peak (after filters and DC blocker) for voice retirement
+    auto range = juce::FloatVectorOperations::findMinAndMax(leftSignal, numSamples);
+    if (rightSignal != leftSignal)
+        range = range.getUnionWith(juce::FloatVectorOperations::findMinAndMax(rightSignal, numSamples));
+    lastPeak = juce::jmax(-range.getStart(), range.getEnd());
+
+    // Calculate base panning (weighted average based on oscillator levels)
+    const float osc1Level = params->osc1Level;
+    const float osc2Level = params->osc2Level;
+    const float osc3Level = params->osc3Level;
+    const float totalLevelForPan = osc1Level + osc2Level + osc3Level;
+    float basePan = 0.0f;
+    if (totalLevelForPan > 0.0f)
+    {
+        basePan = (params->osc1Pan * osc1Level +
+                   params->osc2Pan * osc2Level +
+                   params->osc3Pan * osc3Level) / totalLevelForPan;
+    }
+
+    auto* left = outputBuffer.getWritePointer(0, startSample);
+    auto* right = outputBuffer.getNumChannels() > 1 ? outputBuffer.getWritePointer(1, startSample) : nullptr;
+
+    // Constant power panning: -1.0 = full left, 0.0 = center, +1.0 = full right
+    if (blockModulation.hasPanModulation)
+    {
+        const auto* panMod = scratch.getReadPointer(PanBuffer);
+        auto* panAngle = scratch.getWritePointer(PanBuffer);
+        auto* leftGain = scratch.getWritePointer(LeftGainBuffer);
+        auto* rightGain = scratch.getWritePointer(RightGainBuffer);
+
+        // Pan angles in place, then both gains in one pass
+        for (int sample = 0; sample < numSamples; ++sample)
         {
-            avgPan += lfo3Value; // lfo3Value already includes amount scaling
+            const float pan = juce::jlimit(-1.0f, 1.0f, basePan + panMod[sample]);
+            panAngle[sample] = (pan + 1.0f) * juce::MathConstants<float>::pi / 4.0f;
         }
-        
-        avgPan = juce::jlimit(-1.0f, 1.0f, avgPan); // Clamp to valid range
-
-        // Apply constant power panning (corrected algorithm)
-        // Pan value: -1.0 = full left, 0.0 = center, +1.0 = full right
-        const float panAngle = (avgPan + 1.0f) * juce::MathConstants<float>::pi / 4.0f;
-        leftGain = std::cos(panAngle);
-        rightGain = std::sin(panAngle);
-
-        // Output to stereo buffer
-        outputBuffer.addSample(0, startSample + sample, mixedSample * leftGain);
-        if (outputBuffer.getNumChannels() > 1)
-            outputBuffer.addSample(1, startSample + sample, mixedSample * rightGain);
+
+        FreOscFastMath::sinCosBlock(panAngle, rightGain, leftGain, numSamples, trigPrecision);
+
+        juce::FloatVectorOperations::addWithMultiply(left, leftSignal, leftGain, numSamples);
+        if (right != nullptr)
+            juce::FloatVectorOperations::addWithMultiply(right, rightSignal, rightGain, numSamples);
+    }
+    else
+    {
+        const float panAngle = (juce::jlimit(-1.0f, 1.0f, basePan) + 1.0f) * juce::MathConstants<float>::pi / 4.0f;
+
+        juce::FloatVectorOperations::addWithMultiply(left, leftSignal, FreOscFastMath::cos(panAngle, trigPrecision), numSamples);
+        if (right != nullptr)
+            juce::FloatVectorOperations::addWithMultiply(right, rightSignal, FreOscFastMath::sin(panAngle, trigPrecision), numSamples);
     }
 }
 
+bool FreOscVoice::shouldRetire(int numSamples)
+{
+    // Only a releasing voice is on a falling trajectory - a held note may
+    // just be in a quiet stretch (slow attack, closed filter sweep)
+    if (!isReleasing())
+    {
+        quietSamples = 0;
+        return false;
+    }
+
+    // Volume LFOs can lift the tail by up to 1.5x, keep that much headroom
+    const float headroom = blockModulation.hasVolumeModulation ? 1.5f : 1.0f;
+
+    if (lastPeak * headroom >= params->retireThreshold)
+    {
+        quietSamples = 0;
+        return false;
+    }
+
+    // Quiet long enough for the filters and DC blocker to have rung out
+    quietSamples += numSamples;
+    return quietSamples >= static_cast<int>(retireHoldSeconds * currentSampleRate);
+}
+
+void FreOscVoice::sanitiseBuffer(float* samples, int numSamples)
+{
+    for (int sample = 0; sample < numSamples; ++sample)
+        if (!std::isfinite(samples[sample]))
+            samples[sample] = 0.0f;
+}
+
 //==============================================================================
 bool FreOscVoice::isVoiceActive() const
 {
     return envelope.isActive();
 }
 
+float FreOscVoice::getCurrentLevel() const
+{
+    return envelope.getCurrentLevel() * amplitudeRamp.getCurrentValue();
+}
+
+bool FreOscVoice::isReleasing() const
+{
+    return isRampingDown || envelope.getCurrentPhase() == FreOscEnvelope::Release;
+}
+
 void FreOscVoice::setCurrentPlaybackSampleRate(double sampleRate)
 {
     currentSampleRate = sampleRate;
 
+    // Mod envelope cycle lengths depend on the sample rate
+    parametersApplied = false;
+
     // Prepare all DSP components
     juce::dsp::ProcessSpec spec;
     spec.sampleRate = sampleRate;
@@ -908,12 +1056,15 @@ void FreOscVoice::setCurrentPlaybackSampleRate(double sampleRate)
     oscillator2.prepare(spec);
     oscillator3.prepare(spec);
     pmModulator.prepare(spec);
+    fmEngine.prepare(sampleRate);
     noiseGenerator.prepare(sampleRate);
     lfo.prepare(sampleRate);
 
     // Prepare per-voice filters
     voiceFilter.prepare(spec);
     voiceFilter2.prepare(spec);
+    sideFilter.prepare(spec);
+    sideFilter2.prepare(spec);
 
     envelope.setSampleRate(sampleRate);
     
@@ -934,179 +1085,221 @@ void FreOscVoice::setCurrentPlaybackSampleRate(double sampleRate)
     auto coefficients = juce::dsp::IIR::Coefficients<float>::makeHighPass(sampleRate, 5.0f);
     dcBlocker.coefficients = coefficients;
     dcBlocker.reset();
+
+    sideDcBlocker.prepare(dcSpec);
+    sideDcBlocker.coefficients = coefficients;
+    sideDcBlocker.reset();
 }
 
 //==============================================================================
-// Parameter update methods
-void FreOscVoice::updateOscillatorParameters(
-    int osc1Waveform, int osc1Octave, float osc1Level, float osc1Detune, float osc1Pan,
-    int osc2Waveform, int osc2Octave, float osc2Level, float osc2Detune, float osc2Pan,
-    int osc3Waveform, int osc3Octave, float osc3Level, float osc3Detune, float osc3Pan)
+// Parameter snapshot
+void FreOscVoice::setProfilingStats(FreOscProfilingStats* stats, int indexOfVoice)
+{
+    profilingStats = stats;
+    voiceIndex = indexOfVoice;
+}
+
+void FreOscVoice::setAdditiveProfiles(const FreOscAdditiveProfiles* profiles)
+{
+    for (auto* oscillator : { &oscillator1, &oscillator2, &oscillator3, &pmModulator })
+        oscillator->setAdditiveProfiles(profiles);
+}
+
+void FreOscVoice::setFilterTables(const FreOscFilterTables* tables)
+{
+    for (auto* filter : { &voiceFilter, &voiceFilter2, &sideFilter, &sideFilter2 })
+        filter->setTables(tables);
+}
+
+void FreOscVoice::setParameters(const FreOscVoiceParameters& newParameters)
+{
+    params = &newParameters;
+}
+
+void FreOscVoice::applyParameters()
+{
+    auto groupChanged = [this](FreOscVoiceParameters::Group group)
+    {
+        return !parametersApplied || params->groupVersions[group] != appliedGroupVersions[group];
+    };
+
+    // Only reconfigure what changed - frequency, envelope rate and filter
+    // coefficient calculations are comparatively expensive
+    if (groupChanged(FreOscVoiceParameters::OscillatorGroup)) applyOscillatorParameters();
+    if (groupChanged(FreOscVoiceParameters::NoiseGroup))      applyNoiseParameters();
+    if (groupChanged(FreOscVoiceParameters::EnvelopeGroup))   applyEnvelopeParameters();
+    if (groupChanged(FreOscVoiceParameters::FilterGroup))     applyFilterParameters();
+    if (groupChanged(FreOscVoiceParameters::Filter2Group))    applyFilter2Parameters();
+    if (groupChanged(FreOscVoiceParameters::ModEnv1Group))    applyModEnv1Parameters();
+    if (groupChanged(FreOscVoiceParameters::ModEnv2Group))    applyModEnv2Parameters();
+    if (groupChanged(FreOscVoiceParameters::GlobalGroup))     applyGlobalParameters();
+    if (groupChanged(FreOscVoiceParameters::FMGroup))         applyFMParameters();
+
+    // PM, LFO and the remaining global parameters are read straight from the snapshot
+    std::copy(std::begin(params->groupVersions), std::end(params->groupVersions), std::begin(appliedGroupVersions));
+    parametersApplied = true;
+}
+
+void FreOscVoice::applyOscillatorParameters()
 {
     // Update oscillator 1
-    oscillator1.setWaveform(static_cast<FreOscOscillator::Waveform>(osc1Waveform));
-    oscillator1.setOctave(osc1Octave);
-    oscillator1.setLevel(osc1Level);
-    oscillator1.setDetune(osc1Detune);
-    params.osc1Level = osc1Level;
-    params.osc1Pan = osc1Pan;
+    oscillator1.setWaveform(static_cast<FreOscOscillator::Waveform>(params->osc1Waveform));
+    oscillator1.setOctave(params->osc1Octave);
+    oscillator1.setLevel(params->osc1Level);
+    oscillator1.setDetune(params->osc1Detune);
+    oscillator1.setRenderMode(static_cast<FreOscOscillator::RenderMode>(params->osc1RenderMode));
+    oscillator1.setUnison(params->osc1UnisonVoices, params->osc1UnisonDetune, params->osc1UnisonSpread);
 
     // Update oscillator 2
-    oscillator2.setWaveform(static_cast<FreOscOscillator::Waveform>(osc2Waveform));
-    oscillator2.setOctave(osc2Octave);
-    oscillator2.setLevel(osc2Level);
-    oscillator2.setDetune(osc2Detune);
-    params.osc2Level = osc2Level;
-    params.osc2Pan = osc2Pan;
+    oscillator2.setWaveform(static_cast<FreOscOscillator::Waveform>(params->osc2Waveform));
+    oscillator2.setOctave(params->osc2Octave);
+    oscillator2.setLevel(params->osc2Level);
+    oscillator2.setDetune(params->osc2Detune);
+    oscillator2.setRenderMode(static_cast<FreOscOscillator::RenderMode>(params->osc2RenderMode));
+    oscillator2.setUnison(params->osc2UnisonVoices, params->osc2UnisonDetune, params->osc2UnisonSpread);
 
     // Update oscillator 3
-    oscillator3.setWaveform(static_cast<FreOscOscillator::Waveform>(osc3Waveform));
-    oscillator3.setOctave(osc3Octave);
-    oscillator3.setLevel(osc3Level);
-    oscillator3.setDetune(osc3Detune);
-    params.osc3Level = osc3Level;
-    params.osc3Pan = osc3Pan;
+    oscillator3.setWaveform(static_cast<FreOscOscillator::Waveform>(params->osc3Waveform));
+    oscillator3.setOctave(params->osc3Octave);
+    oscillator3.setLevel(params->osc3Level);
+    oscillator3.setDetune(params->osc3Detune);
+    oscillator3.setRenderMode(static_cast<FreOscOscillator::RenderMode>(params->osc3RenderMode));
+    oscillator3.setUnison(params->osc3UnisonVoices, params->osc3UnisonDetune, params->osc3UnisonSpread);
 
     // Recalculate frequencies if note is active
     if (noteIsOn)
         setupOscillators();
 }
 
-void FreOscVoice::updateNoiseParameters(int noiseType, float noiseLevel, float noisePan)
+void FreOscVoice::applyNoiseParameters()
 {
-    noiseGenerator.setNoiseType(static_cast<FreOscNoiseGenerator::NoiseType>(noiseType));
-    noiseGenerator.setLevel(noiseLevel);
-    noiseGenerator.setPan(noisePan);
-    params.noiseLevel = noiseLevel;
-    params.noisePan = noisePan;
+    noiseGenerator.setNoiseType(static_cast<FreOscNoiseGenerator::NoiseType>(params->noiseType));
+    noiseGenerator.setLevel(params->noiseLevel);
+    noiseGenerator.setPan(params->noisePan);
 }
 
-void FreOscVoice::updateEnvelopeParameters(float attack, float decay, float sustain, float release)
+void FreOscVoice::applyEnvelopeParameters()
 {
-    envelopeParameters.attack = attack;
-    envelopeParameters.decay = decay;
-    envelopeParameters.sustain = sustain;
-    envelopeParameters.release = release;
+    envelopeParameters.attack = params->attack;
+    envelopeParameters.decay = params->decay;
+    envelopeParameters.sustain = params->sustain;
+    envelopeParameters.release = params->release;
     envelope.setParameters(envelopeParameters);
 }
 
-void FreOscVoice::updatePMParameters(float pmIndex, int pmCarrier, float pmRatio)
+void FreOscVoice::applyFilterParameters()
 {
-    params.pmIndex = pmIndex;
-    params.pmCarrier = pmCarrier;
-    params.pmRatio = pmRatio;
-    // Note: OSC3 is always the message signal source
+    for (auto* filter : { &voiceFilter, &sideFilter })
+    {
+        filter->setFilterType(static_cast<FreOscFilter::FilterType>(params->filterType));
+        filter->setCutoffFrequency(params->filterCutoff);
+        filter->setResonance(params->filterResonance);
+        filter->setGain(params->filterGain);
+    }
 }
 
-void FreOscVoice::updateLFOParameters(int lfoWaveform, float lfoRate, int lfoTarget, float lfoAmount)
+void FreOscVoice::applyFilter2Parameters()
 {
-    params.lfoWaveform = lfoWaveform;
-    params.lfoRate = lfoRate;
-    params.lfoTarget = lfoTarget;
-    params.lfoAmount = lfoAmount;
+    for (auto* filter : { &voiceFilter2, &sideFilter2 })
+    {
+        filter->setFilterType(static_cast<FreOscFilter::FilterType>(params->filter2Type));
+        filter->setCutoffFrequency(params->filter2Cutoff);
+        filter->setResonance(params->filter2Resonance);
+        filter->setGain(params->filter2Gain);
+    }
 }
 
-void FreOscVoice::updateLFO2Parameters(int lfo2Waveform, float lfo2Rate, int lfo2Target, float lfo2Amount)
+void FreOscVoice::applyModEnv1Parameters()
 {
-    params.lfo2Waveform = lfo2Waveform;
-    params.lfo2Rate = lfo2Rate;
-    params.lfo2Target = lfo2Target;
-    params.lfo2Amount = lfo2Amount;
-}
+    modEnv1Parameters.attack = params->modEnv1Attack;
+    modEnv1Parameters.decay = params->modEnv1Decay;
+    modEnv1Parameters.sustain = params->modEnv1Sustain;
+    modEnv1Parameters.release = params->modEnv1Release;
+    modEnvelope1.setParameters(modEnv1Parameters);
 
-void FreOscVoice::updateLFO3Parameters(int lfo3Waveform, float lfo3Rate, int lfo3Target, float lfo3Amount)
-{
-    params.lfo3Waveform = lfo3Waveform;
-    params.lfo3Rate = lfo3Rate;
-    params.lfo3Target = lfo3Target;
-    params.lfo3Amount = lfo3Amount;
+    // Calculate cycle length in samples for rate-based modes
+    if (params->modEnv1Mode == 0 || params->modEnv1Mode == 2) // One-Shot or Looping
+        modEnv1State.cycleSamples = currentSampleRate / juce::jmax(0.1f, params->modEnv1Rate); // Prevent division by zero
 }
 
-void FreOscVoice::updateFilterParameters(int filterType, float cutoff, float resonance, float gain)
+void FreOscVoice::applyModEnv2Parameters()
 {
-    params.filterType = filterType;
-    params.filterCutoff = cutoff;
-    params.filterResonance = resonance;
-    params.filterGain = gain;
-
-    // Update the voice filter immediately
-    voiceFilter.setFilterType(static_cast<FreOscFilter::FilterType>(filterType));
-    voiceFilter.setCutoffFrequency(cutoff);
-    voiceFilter.setResonance(resonance);
-    voiceFilter.setGain(gain);
-}
+    modEnv2Parameters.attack = params->modEnv2Attack;
+    modEnv2Parameters.decay = params->modEnv2Decay;
+    modEnv2Parameters.sustain = params->modEnv2Sustain;
+    modEnv2Parameters.release = params->modEnv2Release;
+    modEnvelope2.setParameters(modEnv2Parameters);
 
-void FreOscVoice::updateFilter2Parameters(int filter2Type, float cutoff2, float resonance2, float gain2)
-{
-    params.filter2Type = filter2Type;
-    params.filter2Cutoff = cutoff2;
-    params.filter2Resonance = resonance2;
-    params.filter2Gain = gain2;
-
-    // Update the voice filter 2 immediately
-    voiceFilter2.setFilterType(static_cast<FreOscFilter::FilterType>(filter2Type));
-    voiceFilter2.setCutoffFrequency(cutoff2);
-    voiceFilter2.setResonance(resonance2);
-    voiceFilter2.setGain(gain2);
+    // Calculate cycle length in samples for rate-based modes
+    if (params->modEnv2Mode == 0 || params->modEnv2Mode == 2) // One-Shot or Looping
+        modEnv2State.cycleSamples = currentSampleRate / juce::jmax(0.1f, params->modEnv2Rate); // Prevent division by zero
 }
 
-void FreOscVoice::updateFilterRouting(int routing)
+void FreOscVoice::applyGlobalParameters()
 {
-    params.filterRouting = routing;
+    trigPrecision = static_cast<FreOscFastMath::Precision>(juce::jlimit(0, 2, params->trigPrecision));
+
+    for (auto* oscillator : { &oscillator1, &oscillator2, &oscillator3, &pmModulator })
+        oscillator->setTrigPrecision(trigPrecision);
+
+    for (auto* modulationSource : { &lfo, &lfo2, &lfo3 })
+        modulationSource->setTrigPrecision(trigPrecision);
+
+    fmEngine.setTrigPrecision(trigPrecision);
+
+    const auto filterEngine = static_cast<FreOscFilter::FilterEngine>(juce::jlimit(0, 1, params->filterEngine));
+    for (auto* filter : { &voiceFilter, &voiceFilter2, &sideFilter, &sideFilter2 })
+        filter->setEngine(filterEngine);
 }
 
-void FreOscVoice::updateModEnv1Parameters(float attack, float decay, float sustain, float release, float amount, int target, int mode, float rate)
+void FreOscVoice::applyFMParameters()
 {
-    // Update envelope parameters
-    modEnv1Parameters.attack = attack;
-    modEnv1Parameters.decay = decay;
-    modEnv1Parameters.sustain = sustain;
-    modEnv1Parameters.release = release;
-    modEnvelope1.setParameters(modEnv1Parameters);
+    fmEngine.setAlgorithm(params->fmAlgorithm);
+    fmEngine.setFeedback(params->fmFeedback);
 
-    // Update modulation parameters
-    params.modEnv1Amount = amount;
-    params.modEnv1Target = target;
-    params.modEnv1Mode = mode;
-    params.modEnv1Rate = rate;
-    
-    // Calculate cycle length in samples for rate-based modes
-    if (mode == 0 || mode == 2) // One-Shot or Looping
+    for (int op = 0; op < FreOscVoiceParameters::numFMOperators; ++op)
     {
-        modEnv1CycleSamples = currentSampleRate / juce::jmax(0.1f, rate); // Prevent division by zero
+        const auto& source = params->fmOperators[op];
+
+        FreOscFMEngine::OperatorSettings settings;
+        settings.ratio = source.ratio;
+        settings.level = source.level;
+        settings.envelope.attack = source.attack;
+        settings.envelope.decay = source.decay;
+        settings.envelope.sustain = source.sustain;
+        settings.envelope.release = source.release;
+        fmEngine.setOperator(op, settings);
     }
 }
 
-void FreOscVoice::updateModEnv2Parameters(float attack, float decay, float sustain, float release, float amount, int target, int mode, float rate)
+//==============================================================================
+// Helper methods
+void FreOscVoice::updateNoteFrequency()
 {
-    // Update envelope parameters
-    modEnv2Parameters.attack = attack;
-    modEnv2Parameters.decay = decay;
-    modEnv2Parameters.sustain = sustain;
-    modEnv2Parameters.release = release;
-    modEnvelope2.setParameters(modEnv2Parameters);
+    // Calculate base frequency with pitch bend applied
+    float pitchBendSemitones = currentPitchBend * pitchBendRange;
+    float effectiveNoteNumber = currentMidiNote + pitchBendSemitones;
+    currentNoteFrequency = static_cast<float>(juce::MidiMessage::getMidiNoteInHertz(static_cast<int>(effectiveNoteNumber)));
 
-    // Update modulation parameters
-    params.modEnv2Amount = amount;
-    params.modEnv2Target = target;
-    params.modEnv2Mode = mode;
-    params.modEnv2Rate = rate;
-    
-    // Calculate cycle length in samples for rate-based modes
-    if (mode == 0 || mode == 2) // One-Shot or Looping
+    // If fractional note number, interpolate frequency
+    if (std::abs(effectiveNoteNumber - static_cast<int>(effectiveNoteNumber)) > 1e-6f)
     {
-        modEnv2CycleSamples = currentSampleRate / juce::jmax(0.1f, rate); // Prevent division by zero
+        float fractionalPart = effectiveNoteNumber - static_cast<int>(effectiveNoteNumber);
+        float lowerFreq = static_cast<float>(juce::MidiMessage::getMidiNoteInHertz(static_cast<int>(effectiveNoteNumber)));
+        float upperFreq = static_cast<float>(juce::MidiMessage::getMidiNoteInHertz(static_cast<int>(effectiveNoteNumber) + 1));
+        currentNoteFrequency = lowerFreq + (upperFreq - lowerFreq) * fractionalPart;
     }
+
+    setupOscillators();
 }
 
-//==============================================================================
-// Helper methods
 void FreOscVoice::setupOscillators()
 {
     // Set base frequency for all oscillators
     oscillator1.setFrequency(currentNoteFrequency);
     oscillator2.setFrequency(currentNoteFrequency);
     oscillator3.setFrequency(currentNoteFrequency);
+    fmEngine.setNoteFrequency(currentNoteFrequency);
 }
 
 void FreOscVoice::calculateNoteFrequency(int midiNote, int octaveOffset, float detuneAmount)
@@ -1130,6 +1323,7 @@ void FreOscVoice::syncPMModulatorWithOSC3()
 {
     // Copy OSC3's waveform and settings to PM modulator for consistent character
     pmModulator.setWaveform(oscillator3.getCurrentWaveform());
+    pmModulator.setRenderMode(oscillator3.getCurrentRenderMode());
     
     // Copy OSC3's octave and detune settings so PM character matches OSC3
     // This ensures when user changes OSC3 octave/detune, PM modulator reflects the changes
@@ -1139,11 +1333,22 @@ void FreOscVoice::syncPMModulatorWithOSC3()
     pmModulator.setLevel(1.0f); // PM modulator always at full level for raw waveform
 }
 
+float FreOscVoice::tunePMModulator(float baseRatio)
+{
+    // Set PM modulator frequency to note * ratio (independent of OSC3's frequency),
+    // tuned to the first sample of the block
+    const float modulatorFreq = currentNoteFrequency * baseRatio;
+    if (modulatorFreq != pmModulator.getBaseFrequency())
+        pmModulator.setFrequency(modulatorFreq);
+
+    return baseRatio;
+}
+
 bool FreOscVoice::shouldReceivePM(int oscillatorIndex)
 {
     // Check if the specified oscillator should receive PM modulation
     // OSC3 is always the message signal source, carriers are Osc1, Osc2, or Both
-    int pmCarrier = params.pmCarrier.load();
+    int pmCarrier = params->pmCarrier;
 
     switch (pmCarrier)
     {
@@ -9,6 +9,11 @@
 #include "FreOscSound.h"
 #include "FreOscFilter.h"
 #include "FreOscEnvelope.h"
+#include "FreOscModulationRouting.h"
+#include "FreOscVoiceParameters.h"
+#include "FreOscProfiling.h"
+#include "FreOscHalfBandDecimator.h"
+#include "FreOscFMEngine.h"
 
 //==============================================================================
 /**
@@ -21,6 +26,7 @@
     - ADSR envelope
     - LFO modulation
     - PM (Phase Modulation) synthesis capabilities
+    - Six operator FM engine
 */
 class FreOscVoice : public juce::SynthesiserVoice
 {
@@ -51,42 +57,35 @@ public:
     bool isVoiceActive() const override;
     void setCurrentPlaybackSampleRate(double sampleRate) override;
 
-    //==============================================================================
-    // Parameter updates (called from processor)
-    void updateOscillatorParameters(
-        // Oscillator 1
-        int osc1Waveform, int osc1Octave, float osc1Level, float osc1Detune, float osc1Pan,
-        // Oscillator 2
-        int osc2Waveform, int osc2Octave, float osc2Level, float osc2Detune, float osc2Pan,
-        // Oscillator 3
-        int osc3Waveform, int osc3Octave, float osc3Level, float osc3Detune, float osc3Pan
-    );
-
-    void updateNoiseParameters(int noiseType, float noiseLevel, float noisePan);
-
-    void updateEnvelopeParameters(float attack, float decay, float sustain, float release);
+    // Used by FreOscSynthesiser to pick a voice to steal
+    float getCurrentLevel() const;
+    bool isReleasing() const;
 
-    void updatePMParameters(float pmIndex, int pmCarrier, float pmRatio);
+    // Output peak of the last rendered sub-block
+    float getLastPeak() const { return lastPeak; }
 
-    void updateLFOParameters(int lfoWaveform, float lfoRate, int lfoTarget, float lfoAmount);
-    void updateLFO2Parameters(int lfo2Waveform, float lfo2Rate, int lfo2Target, float lfo2Amount);
-    void updateLFO3Parameters(int lfo3Waveform, float lfo3Rate, int lfo3Target, float lfo3Amount);
+    // Stats block for the stage timers (only filled when FREOSC_ENABLE_PROFILING is on)
+    void setProfilingStats(FreOscProfilingStats* stats, int indexOfVoice);
 
-    void updateFilterParameters(int filterType, float cutoff, float resonance, float gain);
-    
-    void updateFilter2Parameters(int filter2Type, float cutoff2, float resonance2, float gain2);
-    
-    void updateFilterRouting(int routing);
+    // Spectral profiles for additive oscillators (owned by the processor)
+    void setAdditiveProfiles(const FreOscAdditiveProfiles* profiles);
 
-    void updateModEnv1Parameters(float attack, float decay, float sustain, float release, float amount, int target, int mode, float rate);
+    // Prewarped cutoff tables for the voice filters (owned by the processor)
+    void setFilterTables(const FreOscFilterTables* tables);
 
-    void updateModEnv2Parameters(float attack, float decay, float sustain, float release, float amount, int target, int mode, float rate);
+    //==============================================================================
+    // Parameter snapshot published by the processor whenever a parameter changes.
+    // The snapshot must stay alive until the next one is published; changed groups
+    // are pushed into the DSP objects lazily, the next time the voice starts or
+    // renders a note.
+    void setParameters(const FreOscVoiceParameters& newParameters);
 
 private:
     //==============================================================================
     // Audio components
     FreOscOscillator oscillator1, oscillator2, oscillator3;
     FreOscOscillator pmModulator; // Dedicated PM modulator (copies OSC3 settings)
+    FreOscFMEngine fmEngine;      // Six operator FM, mixed in at FM Level
     FreOscNoiseGenerator noiseGenerator;
     FreOscLFO lfo, lfo2, lfo3;
 
@@ -98,18 +97,24 @@ private:
     FreOscEnvelope modEnvelope1, modEnvelope2;
     FreOscEnvelope::Parameters modEnv1Parameters, modEnv2Parameters;
     
-    // Envelope mode state tracking (atomic for thread safety)
-    std::atomic<bool> modEnv1IsLooping{false}, modEnv2IsLooping{false};
-    std::atomic<bool> modEnv1OneShotCompleted{false}, modEnv2OneShotCompleted{false};
-    
-    // Additional state for proper looping implementation
-    std::atomic<int> modEnv1LastMode{1}, modEnv2LastMode{1}; // Track mode changes
-    std::atomic<bool> modEnv1LoopingActive{false}, modEnv2LoopingActive{false};
-    
-    // Per-voice rate-based timing state
-    double modEnv1CycleSamples = 0.0, modEnv2CycleSamples = 0.0;
-    int modEnv1CurrentCycleSample = 0, modEnv2CurrentCycleSample = 0;
-    bool modEnv1CycleActive = false, modEnv2CycleActive = false;
+    // Envelope mode state tracking (one per modulation envelope)
+    struct ModEnvState
+    {
+        // Mode flags (only touched on the audio thread)
+        bool isLooping = false;
+        bool oneShotCompleted = false;
+
+        // Additional state for proper looping implementation
+        int lastMode = 1; // Track mode changes
+        bool loopingActive = false;
+
+        // Per-voice rate-based timing state
+        double cycleSamples = 0.0;
+        int currentCycleSample = 0;
+        bool cycleActive = false;
+    };
+
+    ModEnvState modEnv1State, modEnv2State;
 
     // Panning (stereo positioning)
     juce::dsp::Panner<float> panner1, panner2, panner3, noisePanner;
@@ -120,6 +125,11 @@ private:
     FreOscFilter voiceFilter;
     FreOscFilter voiceFilter2;
 
+    // Same filter settings for the stereo unison side signal (mid/side keeps the
+    // rest of the voice mono)
+    FreOscFilter sideFilter;
+    FreOscFilter sideFilter2;
+
     //==============================================================================
     // Voice state
     double currentSampleRate = 44100.0;
@@ -134,11 +144,96 @@ private:
     
     // DC blocking filter to prevent DC offset pops
     juce::dsp::IIR::Filter<float> dcBlocker;
+    juce::dsp::IIR::Filter<float> sideDcBlocker;
+
+    // Audibility tracking for early voice retirement
+    static constexpr double retireHoldSeconds = 0.02; // Output must stay quiet this long
+    float lastPeak = 0.0f;
+    int quietSamples = 0;
 
     // MIDI modulation state
     float currentPitchBend = 0.0f;        // -1.0 to +1.0 (normalized)
     float pitchBendRange = 2.0f;          // semitones (+/- range)
 
+    // Sine/cosine kernel for the oscillators, LFOs and pan law
+    FreOscFastMath::Precision trigPrecision = FreOscFastMath::Precision::Polynomial;
+
+    //==============================================================================
+    // Block render pipeline - voice-local scratch buffers, allocated once
+    static constexpr int maxSubBlockSize = 64;
+
+    enum ScratchBuffer
+    {
+        MixBuffer = 0,      // Mono source mix, filtered in place
+        GainBuffer,         // Envelope * velocity * CC * anti-pop ramp
+        VolumeModBuffer,    // LFO volume modulation
+        PitchModBuffer,     // LFO pitch modulation (fraction of fundamental)
+        PMIndexBuffer,      // Modulated PM index
+        PMRatioBuffer,      // Modulated PM ratio, then the PM modulator pitch modulation
+        PMSignalBuffer,     // PM modulator output scaled by index
+        Cutoff1Buffer,      // Modulated filter 1 cutoff (normalized)
+        Cutoff2Buffer,      // Modulated filter 2 cutoff (normalized)
+        Filter2Buffer,      // Filter 2 input for parallel routing
+        PanBuffer,          // LFO pan modulation, then the pan angle
+        LeftGainBuffer,     // Per-sample pan gains (only when pan is modulated)
+        RightGainBuffer,
+        SideBuffer,         // Stereo unison side signal, filtered in place
+        SideFilter2Buffer,  // Side filter 2 input for parallel routing
+        NumScratchBuffers
+    };
+
+    juce::AudioBuffer<float> scratch { NumScratchBuffers, maxSubBlockSize };
+
+    // Oversampled PM - with a high index the carrier sidebands reach past Nyquist,
+    // so the PM modulator and the carriers it drives run at 2x/4x and are decimated
+    static constexpr int maxPMOversampling = 4;
+    static constexpr float pmOversamplingIndexThreshold = 1.5f; // Peak reachable PM index that switches it on
+
+    enum OversampledBuffer
+    {
+        OversampledMix = 0,         // PM carrier mix, decimated in place
+        OversampledSide,            // PM carrier unison side signal, decimated in place
+        OversampledCarrierPitch,    // Carrier pitch modulation, incl. the rate change
+        OversampledModulatorPitch,  // PM modulator pitch modulation, incl. the rate change
+        OversampledPMDepth,         // Held PM index * 0.3
+        OversampledPMSignal,        // PM modulator output scaled by index
+        NumOversampledBuffers
+    };
+
+    juce::AudioBuffer<float> oversampledScratch { NumOversampledBuffers, maxSubBlockSize * maxPMOversampling };
+    FreOscHalfBandDecimator pmDecimators[2][2];    // [mix, side][stage]
+    int pmOversamplingFactor = 1;                   // Active for the current note, 1 = off
+
+    // Voice-rate sources are delayed by the decimator latency (whole samples) to stay
+    // lined up with the oversampled carriers
+    static constexpr int maxPMAlignmentDelay = FreOscHalfBandDecimator::outputDelay * 2;
+    float pmAlignmentDelay[2][maxPMAlignmentDelay] = {};   // [mix, side]
+    int pmAlignmentDelaySamples = 0;
+    int pmAlignmentDelayPosition = 0;
+
+    static_assert(maxSubBlockSize * maxPMOversampling <= FreOscHalfBandDecimator::maxInputSamples,
+                  "Decimator input buffer too small for the oversampled sub-block");
+
+    // Control-rate modulation destinations (interpolated to per-sample buffers)
+    struct ControlRateState
+    {
+        float current[FreOscModulationRouting::NumDestinations] = {};
+        float increment[FreOscModulationRouting::NumDestinations] = {};
+        int samplesRemaining = 0;   // Until the next control-rate evaluation
+        bool needsReset = true;     // Jump straight to the first targets of a note
+    } controlRate;
+
+    // Which per-sample destinations are live for the current sub-block
+    struct BlockModulation
+    {
+        bool hasPitchModulation = false;
+        bool hasVolumeModulation = false;
+        bool hasPanModulation = false;
+        bool hasCutoffModulation = false;
+        bool hasCutoff2Modulation = false;
+        bool hasSideSignal = false;     // An oscillator is in stereo unison
+    } blockModulation;
+
     // CC modulation values (0.0 to 1.0, normalized)
     float ccModWheel = 0.0f;              // CC1: Modulation wheel
     float ccVolume = 1.0f;                // CC7: Volume
@@ -146,62 +241,56 @@ private:
     float ccFilterCutoff = 0.0f;          // CC74: Filter cutoff
     float ccFilterResonance = 0.0f;       // CC71: Filter resonance
 
-    // Current parameter values (thread-safe atomic where needed)
-    struct VoiceParameters
-    {
-        // Oscillator levels and settings - very conservative for clean polyphony
-        std::atomic<float> osc1Level{0.3f}, osc2Level{0.15f}, osc3Level{0.05f};
-        std::atomic<float> osc1Pan{0.0f}, osc2Pan{-0.2f}, osc3Pan{0.2f};
-        std::atomic<float> noiseLevel{0.0f}, noisePan{0.0f};
-
-        // PM parameters
-        std::atomic<float> pmIndex{0.0f}, pmRatio{1.0f};
-        std::atomic<int> pmCarrier{0}; // 0=osc1, 1=osc2, 2=both
-
-        // LFO parameters
-        std::atomic<float> lfoRate{2.0f}, lfoAmount{0.0f};
-        std::atomic<int> lfoWaveform{0}, lfoTarget{0}; // 0=sine/none
-        
-        // LFO 2 parameters
-        std::atomic<float> lfo2Rate{2.0f}, lfo2Amount{0.0f};
-        std::atomic<int> lfo2Waveform{0}, lfo2Target{0}; // 0=sine/none
-        
-        // LFO 3 parameters
-        std::atomic<float> lfo3Rate{2.0f}, lfo3Amount{0.0f};
-        std::atomic<int> lfo3Waveform{0}, lfo3Target{0}; // 0=sine/none
-
-        // Filter parameters
-        std::atomic<float> filterCutoff{0.5f}, filterResonance{0.1f}, filterGain{0.5f};
-        std::atomic<int> filterType{0}; // 0=lowpass
-        
-        // Filter 2 parameters
-        std::atomic<float> filter2Cutoff{0.5f}, filter2Resonance{0.1f}, filter2Gain{0.5f};
-        std::atomic<int> filter2Type{0}; // 0=lowpass
-        
-        // Filter routing
-        std::atomic<int> filterRouting{0}; // 0=off
-
-        // Modulation Envelope 1 parameters
-        std::atomic<float> modEnv1Amount{0.0f};
-        std::atomic<int> modEnv1Target{0}; // 0=none
-        std::atomic<int> modEnv1Mode{1}; // 0=One-Shot, 1=Gate, 2=Looping
-        std::atomic<float> modEnv1Rate{1.0f}; // Hz for One-Shot/Looping modes
-
-        // Modulation Envelope 2 parameters
-        std::atomic<float> modEnv2Amount{0.0f};
-        std::atomic<int> modEnv2Target{0}; // 0=none
-        std::atomic<int> modEnv2Mode{1}; // 0=One-Shot, 1=Gate, 2=Looping
-        std::atomic<float> modEnv2Rate{1.0f}; // Hz for One-Shot/Looping modes
-    } params;
+    // Current parameter snapshot (shared with all other voices, read-only)
+    const FreOscVoiceParameters* params;
+    juce::uint32 appliedGroupVersions[FreOscVoiceParameters::NumGroups] = {};
+    bool parametersApplied = false; // False until the DSP objects reflect *params
+
+    // CPU instrumentation
+    FreOscProfilingStats* profilingStats = nullptr;
+    int voiceIndex = 0;
+
+    //==============================================================================
+    // Render pipeline stages
+    int renderSubBlock(juce::AudioBuffer<float>& outputBuffer, int startSample, int numSamples);
+    int renderModulationStage(int numSamples, bool& voiceFinished);
+    void updateControlRateTargets(int numSamples);
+    float getLFOValue(FreOscLFO& source, int waveform, float rate, int target, float amount, int numSamples);
+    float advanceModEnvelope(FreOscEnvelope& modEnvelope, ModEnvState& state, int currentMode, float rate, int numSamples);
+    void renderSourceStage(int numSamples);
+    void renderOscillator(FreOscOscillator& oscillator, float paramLevel, float* destination, float* sideDestination,
+                          const float* pitchModulation, const float* pmInput, int numSamples);
+    void startPMOversampling();
+    void renderOversampledPM(float* mix, float* side, const float* pitchModulation, int numSamples);
+    void alignWithOversampledPM(float* mix, float* side, int numSamples);
+    void renderFilterStage(int numSamples);
+    void renderFilterChannel(float* samples, float* parallelScratch, FreOscFilter& filter1, FreOscFilter& filter2, int numSamples);
+    void renderOutputStage(juce::AudioBuffer<float>& outputBuffer, int startSample, int numSamples);
+    bool shouldRetire(int numSamples);
+    static void sanitiseBuffer(float* samples, int numSamples);
 
     //==============================================================================
     // Helper methods
+    void updateNoteFrequency(); // From the note and pitch bend, then setupOscillators()
     void setupOscillators();
     void calculateNoteFrequency(int midiNote, int octaveOffset, float detuneAmount);
     void syncPMModulatorWithOSC3(); // Copy OSC3 settings to PM modulator
+    float tunePMModulator(float baseRatio); // Returns the ratio the modulator is tuned to
     float getPMModulationSignal();
     bool shouldReceivePM(int oscillatorIndex);
 
+    // Push the current snapshot into the oscillators, envelopes and filters
+    void applyParameters();
+    void applyOscillatorParameters();
+    void applyNoiseParameters();
+    void applyEnvelopeParameters();
+    void applyFilterParameters();
+    void applyFilter2Parameters();
+    void applyModEnv1Parameters();
+    void applyModEnv2Parameters();
+    void applyGlobalParameters();
+    void applyFMParameters();
+
     //==============================================================================
     JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR(FreOscVoice)
 };
\ No newline at end of file
@@ -0,0 +1,668 @@
+#include "FreOscVoiceBank.h"
+#include "FreOscSound.h"
+
+// Used until the processor publishes its first snapshot
+static const FreOscVoiceParameters defaultBankParameters;
+
+//==============================================================================
+FreOscVoiceBank::FreOscVoiceBank()
+    : params(&defaultBankParameters)
+{
+}
+
+FreOscVoiceBank::~FreOscVoiceBank()
+{
+}
+
+//==============================================================================
+void FreOscVoiceBank::prepare(double sampleRate)
+{
+    currentSampleRate = sampleRate;
+
+    // All lane state is allocated here, never on the audio thread
+    groups.assign(static_cast<size_t>(numGroups), LaneGroup{});
+
+    if (noiseGenerators.isEmpty())
+        for (int lane = 0; lane < maxVoices; ++lane)
+            noiseGenerators.add(new FreOscNoiseGenerator());
+
+    for (auto* generator : noiseGenerators)
+        generator->prepare(sampleRate);
+
+    juce::dsp::ProcessSpec spec;
+    spec.sampleRate = sampleRate;
+    spec.maximumBlockSize = maxSubBlockSize;
+    spec.numChannels = 1;
+    filter1.prepare(spec);
+    filter2.prepare(spec);
+
+    // Same DC blocking high-pass as FreOscVoice (cutoff around 5Hz)
+    auto dcCoefficients = juce::dsp::IIR::Coefficients<float>::makeHighPass(sampleRate, 5.0f);
+    std::copy(dcCoefficients->getRawCoefficients(), dcCoefficients->getRawCoefficients() + 5, dcBlockerCoefficients);
+
+    // Sample-rate dependent values have to be recalculated
+    parametersApplied = false;
+
+    reset();
+}
+
+void FreOscVoiceBank::setFilterTables(const FreOscFilterTables* tables)
+{
+    filter1.setTables(tables);
+    filter2.setTables(tables);
+}
+
+void FreOscVoiceBank::reset()
+{
+    std::fill(groups.begin(), groups.end(), LaneGroup{});
+
+    for (auto& lane : lanes)
+        lane.active = false;
+}
+
+void FreOscVoiceBank::setParameters(const FreOscVoiceParameters& newParameters)
+{
+    params = &newParameters;
+}
+
+bool FreOscVoiceBank::supportsParameters(const FreOscVoiceParameters& parameters)
+{
+    // Wavetable lookups are per-lane gathers, which the bank leaves to FreOscVoice,
+    // unison and additive partials already use the SIMD lanes inside the oscillator,
+    // and the bank has neither an FM engine nor state variable filters
+    constexpr int wavetableMode = static_cast<int>(FreOscOscillator::RenderMode::Wavetable);
+    auto usesOscillatorLanes = [](int renderMode, int unisonVoices)
+    {
+        return renderMode == static_cast<int>(FreOscOscillator::RenderMode::Additive) || unisonVoices > 1;
+    };
+
+    return parameters.routing.getNumRoutes() == 0 && parameters.pmIndex <= 0.0f && parameters.fmLevel <= 0.0f
+        && parameters.filterEngine == static_cast<int>(FreOscFilter::Biquad)
+        && parameters.osc1RenderMode != wavetableMode
+        && parameters.osc2RenderMode != wavetableMode
+        && parameters.osc3RenderMode != wavetableMode
+        && !usesOscillatorLanes(parameters.osc1RenderMode, parameters.osc1UnisonVoices)
+        && !usesOscillatorLanes(parameters.osc2RenderMode, parameters.osc2UnisonVoices)
+        && !usesOscillatorLanes(parameters.osc3RenderMode, parameters.osc3UnisonVoices);
+}
+
+//==============================================================================
+void FreOscVoiceBank::startLane(int lane, int midiNoteNumber, float velocity, int currentPitchWheelPosition)
+{
+    jassert(juce::isPositiveAndBelow(lane, maxVoices));
+
+    applyParameters();
+
+    auto& info = lanes[lane];
+    auto& group = getGroup(groups, lane);
+    const auto index = getLaneIndex(lane);
+
+    info.midiNote = midiNoteNumber;
+    info.velocity = velocity;
+    updateLaneFrequency(lane, currentPitchWheelPosition);
+
+    // A fresh lane starts from silent filters; a stolen lane keeps its envelope level
+    if (!info.active)
+    {
+        group.envelopeLevel.set(index, 0.0f);
+
+        for (int stage = 0; stage < 2; ++stage)
+        {
+            group.filterState1[stage].set(index, 0.0f);
+            group.filterState2[stage].set(index, 0.0f);
+            group.dcState[stage].set(index, 0.0f);
+        }
+    }
+
+    // Reset oscillator phases to prevent pops from random starting phases
+    for (int osc = 0; osc < numOscillators; ++osc)
+        group.phase[osc].set(index, 0u);
+
+    group.envelopePhase.set(index, attackPhase);
+    group.noteGain.set(index, info.velocity * info.ccVolume * info.ccExpression);
+
+    // 20ms anti-pop fade-in
+    group.ramp.set(index, 0.0f);
+    group.rampIncrement.set(index, 1.0f / juce::jmax(1.0f, std::floor(0.02f * static_cast<float>(currentSampleRate))));
+    group.rampingDown.set(index, 0.0f);
+
+    info.active = true;
+}
+
+void FreOscVoiceBank::stopLane(int lane, bool allowTailOff)
+{
+    auto& group = getGroup(groups, lane);
+    const auto index = getLaneIndex(lane);
+
+    if (allowTailOff)
+    {
+        // Release from the current level
+        group.envelopePhase.set(index, releasePhase);
+    }
+    else
+    {
+        // 10ms anti-pop fade-out
+        const float steps = juce::jmax(1.0f, std::floor(0.01f * static_cast<float>(currentSampleRate)));
+        group.rampIncrement.set(index, -group.ramp.get(index) / steps);
+        group.rampingDown.set(index, 1.0f);
+    }
+}
+
+void FreOscVoiceBank::setLanePitchWheel(int lane, int newPitchWheelValue)
+{
+    // Retune without touching the phases, as FreOscVoice::pitchWheelMoved does
+    if (lanes[lane].active)
+        updateLaneFrequency(lane, newPitchWheelValue);
+}
+
+void FreOscVoiceBank::setLaneController(int lane, int controllerNumber, int newControllerValue)
+{
+    auto& info = lanes[lane];
+    const float normalizedValue = newControllerValue / 127.0f;
+
+    if (controllerNumber == 7)          // Volume
+        info.ccVolume = normalizedValue;
+    else if (controllerNumber == 11)    // Expression
+        info.ccExpression = normalizedValue;
+    else
+        return;
+
+    getGroup(groups, lane).noteGain.set(getLaneIndex(lane), info.velocity * info.ccVolume * info.ccExpression);
+}
+
+bool FreOscVoiceBank::isLaneActive(int lane) const
+{
+    return lanes[lane].active;
+}
+
+bool FreOscVoiceBank::isLaneReleasing(int lane) const
+{
+    const auto& group = groups[static_cast<size_t>(lane / lanesPerGroup)];
+    const auto index = getLaneIndex(lane);
+    return group.envelopePhase.get(index) == releasePhase || group.rampingDown.get(index) > 0.0f;
+}
+
+float FreOscVoiceBank::getLaneLevel(int lane) const
+{
+    return groups[static_cast<size_t>(lane / lanesPerGroup)].envelopeLevel.get(getLaneIndex(lane));
+}
+
+//==============================================================================
+void FreOscVoiceBank::renderNextBlock(juce::AudioBuffer<float>& outputBuffer, int startSample, int numSamples)
+{
+    if (groups.empty())
+        return;
+
+    applyParameters();
+
+    // Base panning (weighted average based on oscillator levels), shared by all lanes
+    const float totalLevelForPan = params->osc1Level + params->osc2Level + params->osc3Level;
+    float basePan = 0.0f;
+    if (totalLevelForPan > 0.0f)
+    {
+        basePan = (params->osc1Pan * params->osc1Level +
+                   params->osc2Pan * params->osc2Level +
+                   params->osc3Pan * params->osc3Level) / totalLevelForPan;
+    }
+
+    // Constant power panning: -1.0 = full left, 0.0 = center, +1.0 = full right
+    const float panAngle = (juce::jlimit(-1.0f, 1.0f, basePan) + 1.0f) * juce::MathConstants<float>::pi / 4.0f;
+    const float leftGain = FreOscFastMath::cos(panAngle, trigPrecision);
+    const float rightGain = FreOscFastMath::sin(panAngle, trigPrecision);
+
+    while (numSamples > 0)
+    {
+        const int subBlockSize = juce::jmin(numSamples, maxSubBlockSize);
+
+        auto* left = outputBuffer.getWritePointer(0, startSample);
+        auto* right = outputBuffer.getNumChannels() > 1 ? outputBuffer.getWritePointer(1, startSample) : nullptr;
+
+        for (int groupIndex = 0; groupIndex < numGroups; ++groupIndex)
+        {
+            if (!isGroupActive(groupIndex))
+                continue;
+
+            renderGroup(groupIndex, subBlockSize);
+
+            // Sum the lanes of the group and pan into the output
+            for (int sample = 0; sample < subBlockSize; ++sample)
+            {
+                const float groupSum = groupOutput[sample].sum();
+                left[sample] += groupSum * leftGain;
+                if (right != nullptr)
+                    right[sample] += groupSum * rightGain;
+            }
+        }
+
+        startSample += subBlockSize;
+        numSamples -= subBlockSize;
+    }
+}
+
+void FreOscVoiceBank::renderGroup(int groupIndex, int numSamples)
+{
+    auto& group = groups[static_cast<size_t>(groupIndex)];
+    const int firstLane = groupIndex * lanesPerGroup;
+
+    const auto zero = Register::expand(0.0f);
+    const auto one = Register::expand(1.0f);
+    const auto minusOne = Register::expand(-1.0f);
+    const auto largest = Register::expand(std::numeric_limits<float>::max());
+
+    const auto idle = Register::expand(idlePhase);
+    const auto attack = Register::expand(attackPhase);
+    const auto decay = Register::expand(decayPhase);
+    const auto sustain = Register::expand(sustainPhase);
+    const auto release = Register::expand(releasePhase);
+
+    const auto attackRate = Register::expand(envelopeRates.attack);
+    const auto decayRate = Register::expand(envelopeRates.decay);
+    const auto releaseRate = Register::expand(envelopeRates.release);
+    const auto sustainValue = Register::expand(sustainLevel);
+    const auto minimumLevel = Register::expand(0.001f);
+
+    const auto routing = params->filterRouting;
+
+    // Noise has per-lane filter state in every type, so it stays scalar
+    const bool hasNoise = params->noiseLevel > 0.0f;
+    if (hasNoise)
+    {
+        for (size_t index = 0; index < static_cast<size_t>(lanesPerGroup); ++index)
+        {
+            const int lane = firstLane + static_cast<int>(index);
+            auto* generator = noiseGenerators[lane];
+
+            for (int sample = 0; sample < numSamples; ++sample)
+                noiseScratch[sample].set(index, lanes[lane].active ? generator->processSample() : 0.0f);
+        }
+    }
+
+    // Sources, one oscillator at a time so each sample loop runs a single inlined kernel
+    std::fill(sourceScratch, sourceScratch + numSamples, zero);
+
+    for (int osc = 0; osc < numOscillators; ++osc)
+    {
+        if (levels[osc] <= 0.0f)
+            continue;
+
+        // No wavetables in the bank - those modes render as PolyBLEP
+        FreOscSIMDWaveforms::dispatchKernel(waveforms[osc], renderModes[osc], trigPrecision, nullptr, [&](auto kernel)
+        {
+            renderOscillator(group, osc, numSamples, kernel);
+        });
+    }
+
+    for (int sample = 0; sample < numSamples; ++sample)
+    {
+        auto mix = sourceScratch[sample];
+
+        if (hasNoise)
+            mix += noiseScratch[sample];
+
+        // Amplitude envelope (same linear segments as FreOscEnvelope::getNextSample)
+        auto& envelopePhase = group.envelopePhase;
+        auto& envelopeLevel = group.envelopeLevel;
+
+        const auto isAttack = Register::equal(envelopePhase, attack);
+        const auto isDecay = Register::equal(envelopePhase, decay);
+        const auto isSustain = Register::equal(envelopePhase, sustain);
+        const auto isRelease = Register::equal(envelopePhase, release);
+
+        envelopeLevel += attackRate & isAttack;
+        envelopeLevel -= decayRate & isDecay;
+        envelopeLevel -= releaseRate & isRelease;
+        envelopeLevel = FreOscSIMDWaveforms::select(isSustain, sustainValue, envelopeLevel);
+
+        const auto attackDone = isAttack & Register::greaterThanOrEqual(envelopeLevel, one);
+        envelopeLevel = FreOscSIMDWaveforms::select(attackDone, one, envelopeLevel);
+        envelopePhase = FreOscSIMDWaveforms::select(attackDone, decay, envelopePhase);
+
+        const auto decayDone = isDecay & Register::lessThanOrEqual(envelopeLevel, sustainValue);
+        envelopeLevel = FreOscSIMDWaveforms::select(decayDone, sustainValue, envelopeLevel);
+        envelopePhase = FreOscSIMDWaveforms::select(decayDone, sustain, envelopePhase);
+
+        const auto releaseDone = isRelease & Register::lessThanOrEqual(envelopeLevel, zero);
+        envelopeLevel = FreOscSIMDWaveforms::select(releaseDone, zero, envelopeLevel);
+        envelopePhase = FreOscSIMDWaveforms::select(releaseDone, idle, envelopePhase);
+
+        // Anti-pop ramp; a finished fade-out ends the lane
+        group.ramp = Register::max(zero, Register::min(one, group.ramp + group.rampIncrement));
+
+        const auto fadeDone = Register::notEqual(group.rampingDown, zero) & Register::lessThanOrEqual(group.ramp, minimumLevel);
+        envelopeLevel = FreOscSIMDWaveforms::select(fadeDone, zero, envelopeLevel);
+        envelopePhase = FreOscSIMDWaveforms::select(fadeDone, idle, envelopePhase);
+
+        const auto alive = Register::notEqual(envelopePhase, idle);
+
+        // Envelope, velocity, CC and ramp gain (safety check for NaN/infinity first)
+        mix &= Register::lessThanOrEqual(Register::abs(mix), largest);
+        mix *= (Register::max(envelopeLevel, minimumLevel) * group.noteGain * group.ramp) & alive;
+
+        // Dual filter system with coefficients shared by all lanes
+        if (routing == 1) // Parallel
+        {
+            const auto filtered1 = processBiquad(mix, filter1Coefficients, group.filterState1);
+            const auto filtered2 = processBiquad(mix, filter2Coefficients, group.filterState2);
+            mix = (filtered1 + filtered2) * 0.5f;
+        }
+        else
+        {
+            mix = processBiquad(mix, filter1Coefficients, group.filterState1);
+
+            if (routing == 2) // Series
+                mix = processBiquad(mix, filter2Coefficients, group.filterState2);
+        }
+
+        // Polyphony scaling, DC blocking and clipping
+        mix *= 0.3f;
+        mix &= Register::lessThanOrEqual(Register::abs(mix), largest);
+        mix = processBiquad(mix, dcBlockerCoefficients, group.dcState);
+        mix = Register::max(minusOne, Register::min(one, mix));
+
+        groupOutput[sample] = mix & alive;
+    }
+
+    for (size_t index = 0; index < static_cast<size_t>(lanesPerGroup); ++index)
+        lanes[firstLane + static_cast<int>(index)].active = group.envelopePhase.get(index) != idlePhase;
+}
+
+template <typename Kernel>
+void FreOscVoiceBank::renderOscillator(LaneGroup& group, int osc, int numSamples, Kernel kernel)
+{
+    // Local copies so the phases stay in registers
+    auto phase = group.phase[osc];
+    const auto increment = group.phaseIncrement[osc];
+    const auto dt = group.cyclesPerSample[osc];
+    const auto inverseDt = group.samplesPerCycle[osc];
+    const float level = levels[osc];
+
+    for (int sample = 0; sample < numSamples; ++sample)
+    {
+        phase += increment;
+        sourceScratch[sample] += kernel(phase, dt, inverseDt) * level;
+    }
+
+    group.phase[osc] = phase;
+}
+
+bool FreOscVoiceBank::isGroupActive(int groupIndex) const
+{
+    const int firstLane = groupIndex * lanesPerGroup;
+
+    for (int lane = firstLane; lane < firstLane + lanesPerGroup; ++lane)
+        if (lanes[lane].active)
+            return true;
+
+    return false;
+}
+
+//==============================================================================
+void FreOscVoiceBank::applyParameters()
+{
+    auto groupChanged = [this](FreOscVoiceParameters::Group group)
+    {
+        return !parametersApplied || params->groupVersions[group] != appliedGroupVersions[group];
+    };
+
+    if (groupChanged(FreOscVoiceParameters::OscillatorGroup))
+    {
+        waveforms[0] = static_cast<FreOscOscillator::Waveform>(params->osc1Waveform);
+        waveforms[1] = static_cast<FreOscOscillator::Waveform>(params->osc2Waveform);
+        waveforms[2] = static_cast<FreOscOscillator::Waveform>(params->osc3Waveform);
+
+        renderModes[0] = static_cast<FreOscOscillator::RenderMode>(params->osc1RenderMode);
+        renderModes[1] = static_cast<FreOscOscillator::RenderMode>(params->osc2RenderMode);
+        renderModes[2] = static_cast<FreOscOscillator::RenderMode>(params->osc3RenderMode);
+
+        levels[0] = FreOscOscillator::limitLevel(params->osc1Level);
+        levels[1] = FreOscOscillator::limitLevel(params->osc2Level);
+        levels[2] = FreOscOscillator::limitLevel(params->osc3Level);
+
+        // Octave and detune changes retune playing lanes
+        for (int lane = 0; lane < maxVoices; ++lane)
+            if (lanes[lane].active)
+                updateLaneIncrements(lane);
+    }
+
+    if (groupChanged(FreOscVoiceParameters::NoiseGroup))
+    {
+        for (auto* generator : noiseGenerators)
+        {
+            generator->setNoiseType(static_cast<FreOscNoiseGenerator::NoiseType>(params->noiseType));
+            generator->setLevel(params->noiseLevel);
+            generator->setPan(params->noisePan);
+        }
+    }
+
+    if (groupChanged(FreOscVoiceParameters::EnvelopeGroup))
+    {
+        FreOscEnvelope::Parameters envelopeParameters;
+        envelopeParameters.attack = params->attack;
+        envelopeParameters.decay = params->decay;
+        envelopeParameters.sustain = params->sustain;
+        envelopeParameters.release = params->release;
+
+        envelopeRates = FreOscEnvelope::calculateRates(envelopeParameters, currentSampleRate);
+        sustainLevel = params->sustain;
+    }
+
+    if (groupChanged(FreOscVoiceParameters::FilterGroup))
+    {
+        filter1.setFilterType(static_cast<FreOscFilter::FilterType>(params->filterType));
+        filter1.setCutoffFrequency(params->filterCutoff);
+        filter1.setResonance(params->filterResonance);
+        filter1.setGain(params->filterGain);
+        filter1.setSharedCoefficients(&params->filterCoefficients);
+
+        std::copy(filter1.getRawCoefficients(), filter1.getRawCoefficients() + 5, filter1Coefficients);
+    }
+
+    if (groupChanged(FreOscVoiceParameters::Filter2Group))
+    {
+        filter2.setFilterType(static_cast<FreOscFilter::FilterType>(params->filter2Type));
+        filter2.setCutoffFrequency(params->filter2Cutoff);
+        filter2.setResonance(params->filter2Resonance);
+        filter2.setGain(params->filter2Gain);
+        filter2.setSharedCoefficients(&params->filter2Coefficients);
+
+        std::copy(filter2.getRawCoefficients(), filter2.getRawCoefficients() + 5, filter2Coefficients);
+    }
+
+    if (groupChanged(FreOscVoiceParameters::GlobalGroup))
+        trigPrecision = static_cast<FreOscFastMath::Precision>(juce::jlimit(0, 2, params->trigPrecision));
+
+    std::copy(std::begin(params->groupVersions), std::end(params->groupVersions), std::begin(appliedGroupVersions));
+    parametersApplied = true;
+}
+
+void FreOscVoiceBank::updateLaneFrequency(int lane, int pitchWheelPosition)
+{
+    auto& info = lanes[lane];
+
+    // Base frequency with pitch bend applied (same as FreOscVoice::updateNoteFrequency)
+    const float pitchBendSemitones = (pitchWheelPosition - 8192) / 8192.0f * 2.0f;
+    const float effectiveNoteNumber = info.midiNote + pitchBendSemitones;
+    const int lowerNote = static_cast<int>(effectiveNoteNumber);
+    info.noteFrequency = static_cast<float>(juce::MidiMessage::getMidiNoteInHertz(lowerNote));
+
+    const float fractionalPart = effectiveNoteNumber - static_cast<float>(lowerNote);
+    if (std::abs(fractionalPart) > 1e-6f)
+    {
+        const float upperFreq = static_cast<float>(juce::MidiMessage::getMidiNoteInHertz(lowerNote + 1));
+        info.noteFrequency += (upperFreq - info.noteFrequency) * fractionalPart;
+    }
+
+    updateLaneIncrements(lane);
+}
+
+void FreOscVoiceBank::updateLaneIncrements(int lane)
+{
+    auto& group = getGroup(groups, lane);
+    const auto index = getLaneIndex(lane);
+    const float noteFrequency = lanes[lane].noteFrequency;
+
+    const int octaves[] = { params->osc1Octave, params->osc2Octave, params->osc3Octave };
+    const float detunes[] = { params->osc1Detune, params->osc2Detune, params->osc3Detune };
+
+    for (int osc = 0; osc < numOscillators; ++osc)
+    {
+        const float frequency = FreOscOscillator::calculateFrequency(noteFrequency, octaves[osc], detunes[osc]);
+        group.phaseIncrement[osc].set(index, FreOscFastMath::phaseIncrementForFrequency(frequency, currentSampleRate));
+
+        // Same limits as FreOscOscillator::generateBandLimitedWaveform
+        const float dt = juce::jlimit(1.0e-6f, 0.5f, frequency / static_cast<float>(currentSampleRate));
+        group.cyclesPerSample[osc].set(index, dt);
+        group.samplesPerCycle[osc].set(index, 1.0f / dt);
+    }
+}
+
+//==============================================================================
+FreOscVoiceBank::Register FreOscVoiceBank::processBiquad(Register input, const float* coefficients, Register* state)
+{
+    // Transposed direct form II, same as juce::dsp::IIR::Filter
+    const auto output = input * coefficients[0] + state[0];
+    state[0] = input * coefficients[1] - output * coefficients[3] + state[1];
+    state[1] = input * coefficients[2] - output * coefficients[4];
+    return output;
+}
+
+//==============================================================================
+FreOscBankVoice::FreOscBankVoice(FreOscVoiceBank& bankToUse, int laneIndex)
+    : bank(bankToUse), lane(laneIndex)
+{
+}
+
+bool FreOscBankVoice::canPlaySound(juce::SynthesiserSound* sound)
+{
+    return dynamic_cast<FreOscSound*>(sound) != nullptr;
+}
+
+void FreOscBankVoice::startNote(int midiNoteNumber, float velocity, juce::SynthesiserSound* sound, int currentPitchWheelPosition)
+{
+    juce::ignoreUnused(sound);
+    bank.startLane(lane, midiNoteNumber, velocity, currentPitchWheelPosition);
+}
+
+void FreOscBankVoice::stopNote(float velocity, bool allowTailOff)
+{
+    juce::ignoreUnused(velocity);
+    bank.stopLane(lane, allowTailOff);
+}
+
+void FreOscBankVoice::pitchWheelMoved(int newPitchWheelValue)
+{
+    if (getCurrentlyPlayingNote() >= 0)
+        bank.setLanePitchWheel(lane, newPitchWheelValue);
+}
+
+void FreOscBankVoice::controllerMoved(int controllerNumber, int newControllerValue)
+{
+    bank.setLaneController(lane, controllerNumber, newControllerValue);
+}
+
+void FreOscBankVoice::renderNextBlock(juce::AudioBuffer<float>& outputBuffer, int startSample, int numSamples)
+{
+    // FreOscBankSynthesiser renders all lanes at once
+    juce::ignoreUnused(outputBuffer, startSample, numSamples);
+}
+
+bool FreOscBankVoice::isVoiceActive() const
+{
+    return bank.isLaneActive(lane);
+}
+
+bool FreOscBankVoice::isReleasing() const
+{
+    return bank.isLaneReleasing(lane);
+}
+
+float FreOscBankVoice::getCurrentLevel() const
+{
+    return bank.getLaneLevel(lane);
+}
+
+void FreOscBankVoice::syncWithBank()
+{
+    if (getCurrentlyPlayingNote() >= 0 && !bank.isLaneActive(lane))
+        clearCurrentNote();
+}
+
+//==============================================================================
+FreOscBankSynthesiser::FreOscBankSynthesiser(FreOscVoiceBank& bankToUse)
+    : bank(bankToUse)
+{
+}
+
+void FreOscBankSynthesiser::createVoices()
+{
+    for (int lane = 0; lane < FreOscVoiceBank::maxVoices; ++lane)
+        addVoice(new FreOscBankVoice(bank, lane));
+}
+
+void FreOscBankSynthesiser::setVoiceLimit(int newVoiceLimit)
+{
+    voiceLimit = juce::jlimit(1, FreOscVoiceBank::maxVoices, newVoiceLimit);
+}
+
+void FreOscBankSynthesiser::renderVoices(juce::AudioBuffer<float>& outputAudio, int startSample, int numSamples)
+{
+    bank.renderNextBlock(outputAudio, startSample, numSamples);
+
+    for (auto* voice : voices)
+        static_cast<FreOscBankVoice*>(voice)->syncWithBank();
+}
+
+juce::SynthesiserVoice* FreOscBankSynthesiser::findFreeVoice(juce::SynthesiserSound* soundToPlay, int midiChannel,
+                                                             int midiNoteNumber, bool stealIfNoneAvailable) const
+{
+    const juce::ScopedLock sl(lock);
+
+    for (int i = 0; i < getNumUsableVoices(); ++i)
+    {
+        auto* voice = voices.getUnchecked(i);
+
+        if (!voice->isVoiceActive() && voice->canPlaySound(soundToPlay))
+            return voice;
+    }
+
+    if (stealIfNoneAvailable)
+        return findVoiceToSteal(soundToPlay, midiChannel, midiNoteNumber);
+
+    return nullptr;
+}
+
+juce::SynthesiserVoice* FreOscBankSynthesiser::findVoiceToSteal(juce::SynthesiserSound* soundToPlay, int midiChannel,
+                                                                int midiNoteNumber) const
+{
+    juce::ignoreUnused(midiChannel);
+
+    // Same order as FreOscSynthesiser: releasing lanes, then sustained (key up), then held,
+    // the quietest first within each
+    juce::SynthesiserVoice* bestVoice = nullptr;
+    int bestStage = 0;
+    float bestLevel = 0.0f;
+
+    for (int i = 0; i < getNumUsableVoices(); ++i)
+    {
+        auto* voice = static_cast<FreOscBankVoice*>(voices.getUnchecked(i));
+
+        if (!voice->canPlaySound(soundToPlay))
+            continue;
+
+        // Retrigger a lane that is already playing this note
+        if (voice->getCurrentlyPlayingNote() == midiNoteNumber)
+            return voice;
+
+        const int stage = voice->isReleasing() ? 0 : (voice->isKeyDown() ? 2 : 1);
+        const float level = voice->getCurrentLevel();
+
+        if (bestVoice == nullptr || stage < bestStage || (stage == bestStage && level < bestLevel))
+        {
+            bestVoice = voice;
+            bestStage = stage;
+            bestLevel = level;
+        }
+    }
+
+    return bestVoice;
+}
@@ -0,0 +1,242 @@
+#pragma once
+
+#include <juce_audio_basics/juce_audio_basics.h>
+#include <juce_dsp/juce_dsp.h>
+#include <vector>
+#include "FreOscOscillator.h"
+#include "FreOscNoiseGenerator.h"
+#include "FreOscEnvelope.h"
+#include "FreOscFilter.h"
+#include "FreOscVoiceParameters.h"
+#include "FreOscSIMDWaveforms.h"
+
+//==============================================================================
+/**
+    FreOSC Voice Bank
+
+    Alternative voice engine that keeps the state of every voice in
+    structure-of-arrays form and renders lane groups of 4 (SSE/NEON) or
+    8 (AVX) voices in lockstep with juce::dsp::SIMDRegister.
+
+    Per lane: normalised 32-bit oscillator phases and increments, amplitude envelope, anti-pop
+    ramp, note gain, filter and DC blocker state. Everything the voices share
+    (waveforms, levels, envelope rates, filter coefficients, pan) is taken
+    from the parameter snapshot once and broadcast across the lanes. The
+    oscillator, envelope and filter maths are the same as FreOscOscillator,
+    FreOscEnvelope and FreOscFilter.
+
+    Only the unmodulated signal path is supported: patches with LFO or mod
+    envelope routes, PM, FM, wavetable, additive or unison oscillators, or
+    state variable filters render on the regular FreOscVoice engine (see
+    supportsParameters()). The processor makes that choice per note, so
+    lanes already playing when the patch changes finish here and skip what
+    the bank cannot render.
+
+    Note handling stays with juce::Synthesiser: FreOscBankVoice maps a
+    synthesiser voice to a lane, and FreOscBankSynthesiser renders the whole
+    bank once per sub-block instead of voice by voice.
+*/
+class FreOscVoiceBank
+{
+public:
+    //==============================================================================
+    using Register = FreOscSIMDWaveforms::Register;
+    using PhaseRegister = FreOscSIMDWaveforms::PhaseRegister;
+
+    static constexpr int lanesPerGroup = static_cast<int>(Register::SIMDNumElements);
+    static constexpr int maxVoices = 128;
+    static constexpr int numGroups = maxVoices / lanesPerGroup;
+
+    //==============================================================================
+    FreOscVoiceBank();
+    ~FreOscVoiceBank();
+
+    //==============================================================================
+    void prepare(double sampleRate);
+    void reset();
+
+    // Prewarped cutoff tables for the shared filter coefficients (owned by the processor)
+    void setFilterTables(const FreOscFilterTables* tables);
+
+    // Parameter snapshot published by the processor (same lifetime rules as FreOscVoice)
+    void setParameters(const FreOscVoiceParameters& newParameters);
+
+    // Whether the bank can render a patch - modulation and PM need FreOscVoice
+    static bool supportsParameters(const FreOscVoiceParameters& parameters);
+
+    //==============================================================================
+    // Lane control (called by FreOscBankVoice)
+    void startLane(int lane, int midiNoteNumber, float velocity, int currentPitchWheelPosition);
+    void stopLane(int lane, bool allowTailOff);
+    void setLanePitchWheel(int lane, int newPitchWheelValue);
+    void setLaneController(int lane, int controllerNumber, int newControllerValue);
+    bool isLaneActive(int lane) const;
+
+    // For voice stealing: releasing or fading out, and the current envelope level
+    bool isLaneReleasing(int lane) const;
+    float getLaneLevel(int lane) const;
+
+    // Adds all active lanes into the output buffer
+    void renderNextBlock(juce::AudioBuffer<float>& outputBuffer, int startSample, int numSamples);
+
+private:
+    //==============================================================================
+    static constexpr int numOscillators = 3;
+    static constexpr int maxSubBlockSize = 64;
+
+    // Envelope phases stored as floats so they can be compared lane-wise
+    static constexpr float idlePhase = static_cast<float>(FreOscEnvelope::Idle);
+    static constexpr float attackPhase = static_cast<float>(FreOscEnvelope::Attack);
+    static constexpr float decayPhase = static_cast<float>(FreOscEnvelope::Decay);
+    static constexpr float sustainPhase = static_cast<float>(FreOscEnvelope::Sustain);
+    static constexpr float releasePhase = static_cast<float>(FreOscEnvelope::Release);
+
+    // One group of lanes rendered together
+    struct LaneGroup
+    {
+        PhaseRegister phase[numOscillators];            // Normalised, wraps by overflow
+        PhaseRegister phaseIncrement[numOscillators];
+        Register cyclesPerSample[numOscillators];   // PolyBLEP dt and 1/dt
+        Register samplesPerCycle[numOscillators];
+
+        Register envelopePhase;
+        Register envelopeLevel;
+
+        Register ramp;              // Anti-pop fade in/out
+        Register rampIncrement;
+        Register rampingDown;       // 1.0 while fading out after a hard stop
+
+        Register noteGain;          // Velocity * CC volume * CC expression
+
+        Register filterState1[2], filterState2[2];
+        Register dcState[2];
+    };
+
+    // Per-lane note data that never needs to be vectorised
+    struct LaneInfo
+    {
+        int midiNote = 69;
+        float noteFrequency = 440.0f;
+        float velocity = 1.0f;
+        float ccVolume = 1.0f;
+        float ccExpression = 1.0f;
+        bool active = false;
+    };
+
+    std::vector<LaneGroup> groups;
+    LaneInfo lanes[maxVoices];
+    juce::OwnedArray<FreOscNoiseGenerator> noiseGenerators;
+
+    //==============================================================================
+    // Shared state, applied from the snapshot
+    const FreOscVoiceParameters* params;
+    juce::uint32 appliedGroupVersions[FreOscVoiceParameters::NumGroups] = {};
+    bool parametersApplied = false;
+
+    double currentSampleRate = 44100.0;
+
+    FreOscOscillator::Waveform waveforms[numOscillators] = {};
+    FreOscOscillator::RenderMode renderModes[numOscillators] = {};
+    float levels[numOscillators] = {};
+    FreOscEnvelope::Rates envelopeRates;
+    float sustainLevel = 0.6f;
+    FreOscFastMath::Precision trigPrecision = FreOscFastMath::Precision::Polynomial;
+
+    // Coefficient sources - their own filter state is never used
+    FreOscFilter filter1, filter2;
+    float filter1Coefficients[5] = { 1.0f, 0.0f, 0.0f, 0.0f, 0.0f };
+    float filter2Coefficients[5] = { 1.0f, 0.0f, 0.0f, 0.0f, 0.0f };
+    float dcBlockerCoefficients[5] = { 1.0f, 0.0f, 0.0f, 0.0f, 0.0f };
+
+    // Interleaved (sample-major) output of one lane group for one sub-block
+    Register groupOutput[maxSubBlockSize];
+    Register sourceScratch[maxSubBlockSize];
+    Register noiseScratch[maxSubBlockSize];
+
+    //==============================================================================
+    void applyParameters();
+    void updateLaneFrequency(int lane, int pitchWheelPosition);
+    void updateLaneIncrements(int lane);
+    bool isGroupActive(int groupIndex) const;
+
+    void renderGroup(int groupIndex, int numSamples);
+    template <typename Kernel>
+    void renderOscillator(LaneGroup& group, int osc, int numSamples, Kernel kernel);
+    static Register processBiquad(Register input, const float* coefficients, Register* state);
+
+    static LaneGroup& getGroup(std::vector<LaneGroup>& groups, int lane) { return groups[static_cast<size_t>(lane / lanesPerGroup)]; }
+    static size_t getLaneIndex(int lane) { return static_cast<size_t>(lane % lanesPerGroup); }
+
+    //==============================================================================
+    JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR(FreOscVoiceBank)
+};
+
+//==============================================================================
+/**
+    Synthesiser voice that plays one lane of a FreOscVoiceBank.
+    Rendering happens in FreOscBankSynthesiser, for all lanes at once.
+*/
+class FreOscBankVoice : public juce::SynthesiserVoice
+{
+public:
+    FreOscBankVoice(FreOscVoiceBank& bankToUse, int laneIndex);
+
+    bool canPlaySound(juce::SynthesiserSound* sound) override;
+    void startNote(int midiNoteNumber, float velocity, juce::SynthesiserSound* sound, int currentPitchWheelPosition) override;
+    void stopNote(float velocity, bool allowTailOff) override;
+    void pitchWheelMoved(int newPitchWheelValue) override;
+    void controllerMoved(int controllerNumber, int newControllerValue) override;
+    void renderNextBlock(juce::AudioBuffer<float>& outputBuffer, int startSample, int numSamples) override;
+    bool isVoiceActive() const override;
+
+    bool isReleasing() const;
+    float getCurrentLevel() const;
+
+    // Frees the synthesiser voice once its lane has finished
+    void syncWithBank();
+
+private:
+    FreOscVoiceBank& bank;
+    const int lane;
+
+    JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR(FreOscBankVoice)
+};
+
+//==============================================================================
+/**
+    Synthesiser that renders a FreOscVoiceBank once per sub-block
+    instead of asking each voice to render itself.
+
+    Voice limit and stealing work as in FreOscSynthesiser: only the first
+    setVoiceLimit() lanes take new notes, and stealing prefers releasing
+    lanes, then lanes whose key is up, then the quietest.
+*/
+class FreOscBankSynthesiser : public juce::Synthesiser
+{
+public:
+    explicit FreOscBankSynthesiser(FreOscVoiceBank& bankToUse);
+
+    // Adds one FreOscBankVoice per bank lane
+    void createVoices();
+
+    // Number of lanes that may play new notes (lanes above the limit finish their notes)
+    void setVoiceLimit(int newVoiceLimit);
+    int getVoiceLimit() const { return voiceLimit; }
+
+protected:
+    using juce::Synthesiser::renderVoices;
+    void renderVoices(juce::AudioBuffer<float>& outputAudio, int startSample, int numSamples) override;
+
+    juce::SynthesiserVoice* findFreeVoice(juce::SynthesiserSound* soundToPlay, int midiChannel,
+                                          int midiNoteNumber, bool stealIfNoneAvailable) const override;
+    juce::SynthesiserVoice* findVoiceToSteal(juce::SynthesiserSound* soundToPlay, int midiChannel,
+                                             int midiNoteNumber) const override;
+
+private:
+    FreOscVoiceBank& bank;
+    int voiceLimit = FreOscVoiceBank::maxVoices;
+
+    int getNumUsableVoices() const { return juce::jmin(voiceLimit, voices.size()); }
+
+    JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR(FreOscBankSynthesiser)
+};
@@ -0,0 +1,129 @@
+#pragma once
+
+#include <juce_core/juce_core.h>
+#include <type_traits>
+#include "FreOscModulationRouting.h"
+#include "FreOscFilterCoefficients.h"
+
+//==============================================================================
+/**
+    FreOSC Voice Parameter Snapshot
+
+    Plain copy of every per-voice parameter, built once per block by the
+    processor and shared by all voices through a const pointer. The processor
+    double-buffers two snapshots: it fills the one the voices are not reading,
+    then publishes it, so voices always see a complete and consistent set.
+
+    Voices read the fields directly (no atomics). Parameters are grouped by the
+    DSP object they configure; each group carries its own version so a voice
+    only reconfigures the oscillators, envelopes or filters that changed.
+*/
+struct alignas(64) FreOscVoiceParameters
+{
+    enum Group
+    {
+        OscillatorGroup = 0,
+        NoiseGroup,
+        EnvelopeGroup,
+        PMGroup,
+        LFOGroup,
+        FilterGroup,
+        Filter2Group,
+        ModEnv1Group,
+        ModEnv2Group,
+        GlobalGroup,        // Filter routing, modulation quality, voice retirement, trig precision
+        FMGroup,
+        NumGroups
+    };
+
+    // Oscillators
+    int osc1Waveform = 0, osc1Octave = 0;
+    float osc1Level = 0.3f, osc1Detune = 0.0f, osc1Pan = 0.0f;
+
+    int osc2Waveform = 0, osc2Octave = 0;
+    float osc2Level = 0.15f, osc2Detune = 0.0f, osc2Pan = -0.2f;
+
+    int osc3Waveform = 0, osc3Octave = 0;
+    float osc3Level = 0.05f, osc3Detune = 0.0f, osc3Pan = 0.2f;
+
+    int osc1RenderMode = 0, osc2RenderMode = 0, osc3RenderMode = 0; // 0=Raw, 1=PolyBLEP, 2=Wavetable, 3=Additive
+
+    // Unison: copies (1-8), total detune width in cents, stereo spread (0-1)
+    int osc1UnisonVoices = 1, osc2UnisonVoices = 1, osc3UnisonVoices = 1;
+    float osc1UnisonDetune = 25.0f, osc2UnisonDetune = 25.0f, osc3UnisonDetune = 25.0f;
+    float osc1UnisonSpread = 0.5f, osc2UnisonSpread = 0.5f, osc3UnisonSpread = 0.5f;
+
+    // Noise
+    int noiseType = 0;
+    float noiseLevel = 0.0f, noisePan = 0.0f;
+
+    // Amplitude envelope
+    float attack = 0.1f, decay = 0.3f, sustain = 0.6f, release = 0.5f;
+
+    // PM synthesis
+    float pmIndex = 0.0f, pmRatio = 1.0f;
+    int pmCarrier = 0; // 0=osc1, 1=osc2, 2=both
+    int pmOversampling = 1; // 0=Off, 1=2x, 2=4x
+
+    // FM operator engine: level is a carrier's output or a modulator's index
+    struct FMOperator
+    {
+        float ratio = 1.0f, level = 0.0f;
+        float attack = 0.0f, decay = 0.3f, sustain = 1.0f, release = 0.3f;
+    };
+
+    static constexpr int numFMOperators = 6;
+    FMOperator fmOperators[numFMOperators];
+    int fmAlgorithm = 0;
+    float fmLevel = 0.0f, fmFeedback = 0.0f;
+
+    // LFOs
+    int lfoWaveform = 0, lfoTarget = 0;
+    float lfoRate = 2.0f, lfoAmount = 0.0f;
+
+    int lfo2Waveform = 0, lfo2Target = 0;
+    float lfo2Rate = 2.0f, lfo2Amount = 0.0f;
+
+    int lfo3Waveform = 0, lfo3Target = 0;
+    float lfo3Rate = 2.0f, lfo3Amount = 0.0f;
+
+    // Filters
+    int filterType = 0;
+    float filterCutoff = 0.5f, filterResonance = 0.1f, filterGain = 0.5f;
+
+    int filter2Type = 0;
+    float filter2Cutoff = 0.5f, filter2Resonance = 0.1f, filter2Gain = 0.5f;
+
+    int filterRouting = 0; // 0=off
+    int filterEngine = 0;  // 0=Biquad, 1=State Variable (both filters)
+
+    // Modulation envelopes
+    float modEnv1Attack = 0.01f, modEnv1Decay = 0.2f, modEnv1Sustain = 0.8f, modEnv1Release = 0.3f;
+    float modEnv1Amount = 0.0f, modEnv1Rate = 1.0f;
+    int modEnv1Target = 0, modEnv1Mode = 1; // Mode: 0=One-Shot, 1=Gate, 2=Looping
+
+    float modEnv2Attack = 0.01f, modEnv2Decay = 0.2f, modEnv2Sustain = 0.8f, modEnv2Release = 0.3f;
+    float modEnv2Amount = 0.0f, modEnv2Rate = 1.0f;
+    int modEnv2Target = 0, modEnv2Mode = 1;
+
+    // Modulation quality: samples per LFO/mod envelope evaluation
+    int controlRateDivisor = 16;
+
+    // Releasing voices whose output stays below this gain are retired (-96 dBFS)
+    float retireThreshold = 1.58489e-5f;
+
+    // Sine/cosine kernels for oscillators, LFOs and panning: 0=Exact, 1=Polynomial, 2=Table
+    int trigPrecision = 1;
+
+    // LFO / mod envelope targets compiled into active routes
+    FreOscModulationRouting routing;
+
+    // Filter 1 and 2 designed once for all voices (voices with cutoff modulation design their own)
+    FreOscFilterCoefficients filterCoefficients, filter2Coefficients;
+
+    // Bumped by the processor whenever a parameter in the group changes
+    juce::uint32 groupVersions[NumGroups] = {};
+};
+
+static_assert(std::is_trivially_copyable<FreOscVoiceParameters>::value,
+              "Voice parameter snapshots must stay plain data");
@@ -0,0 +1,137 @@
+#include "FreOscWavetable.h"
+
+//==============================================================================
+FreOscWavetable::FreOscWavetable()
+    : tables(static_cast<size_t>(numMipLevels * (tableSize + 1)), 0.0f)
+{
+}
+
+//==============================================================================
+void FreOscWavetable::buildFromHarmonics(const float* cosineAmplitudes, const float* sineAmplitudes)
+{
+    juce::dsp::FFT fft(fftOrder);
+    std::vector<float> spectrum(static_cast<size_t>(tableSize * 2));
+
+    for (int level = 0; level < numMipLevels; ++level)
+    {
+        const int maxHarmonic = numHarmonics >> level;
+        std::fill(spectrum.begin(), spectrum.end(), 0.0f);
+
+        // Real-only inverse FFT input: interleaved complex bins, X[k] = N/2 * (a_k - i * b_k)
+        const float binScale = static_cast<float>(tableSize) * 0.5f;
+        spectrum[0] = cosineAmplitudes[0] * static_cast<float>(tableSize);
+
+        for (int harmonic = 1; harmonic <= maxHarmonic && harmonic < numHarmonics; ++harmonic)
+        {
+            spectrum[static_cast<size_t>(harmonic * 2)] = cosineAmplitudes[harmonic] * binScale;
+            spectrum[static_cast<size_t>(harmonic * 2 + 1)] = -sineAmplitudes[harmonic] * binScale;
+        }
+
+        fft.performRealOnlyInverseTransform(spectrum.data());
+
+        auto* table = tables.data() + level * (tableSize + 1);
+        std::copy(spectrum.begin(), spectrum.begin() + tableSize, table);
+        table[tableSize] = table[0];
+    }
+}
+
+void FreOscWavetable::buildFromSingleCycle(const float* samples, int numSamples)
+{
+    jassert(numSamples > 1);
+
+    juce::dsp::FFT fft(fftOrder);
+    std::vector<float> data(static_cast<size_t>(tableSize * 2), 0.0f);
+
+    // Resample the cycle to the table size
+    for (int i = 0; i < tableSize; ++i)
+    {
+        const float position = static_cast<float>(i) * static_cast<float>(numSamples) / static_cast<float>(tableSize);
+        const int index = static_cast<int>(position);
+        const float fraction = position - static_cast<float>(index);
+        const float current = samples[index];
+        const float next = samples[(index + 1) % numSamples];
+        data[static_cast<size_t>(i)] = current + (next - current) * fraction;
+    }
+
+    fft.performRealOnlyForwardTransform(data.data());
+
+    // Back to harmonic amplitudes (inverse of the scaling in buildFromHarmonics)
+    std::vector<float> cosine(static_cast<size_t>(numHarmonics + 1), 0.0f);
+    std::vector<float> sine(static_cast<size_t>(numHarmonics + 1), 0.0f);
+    const float binScale = 2.0f / static_cast<float>(tableSize);
+
+    cosine[0] = data[0] / static_cast<float>(tableSize);
+    for (int harmonic = 1; harmonic < numHarmonics; ++harmonic)
+    {
+        cosine[static_cast<size_t>(harmonic)] = data[static_cast<size_t>(harmonic * 2)] * binScale;
+        sine[static_cast<size_t>(harmonic)] = -data[static_cast<size_t>(harmonic * 2 + 1)] * binScale;
+    }
+
+    buildFromHarmonics(cosine.data(), sine.data());
+}
+
+//==============================================================================
+int FreOscWavetable::getMipLevel(float cyclesPerSample)
+{
+    // Smallest level whose highest harmonic stays below Nyquist:
+    // (numHarmonics >> level) * cyclesPerSample < 0.5  ->  level = ceil(log2(tableSize * cyclesPerSample))
+    int exponent = 0;
+    const float mantissa = std::frexp(static_cast<float>(tableSize) * std::abs(cyclesPerSample), &exponent);
+    const int level = mantissa > 0.5f ? exponent : exponent - 1;
+
+    return juce::jlimit(0, numMipLevels - 1, level);
+}
+
+float FreOscWavetable::getSample(int mipLevel, float phaseInCycles) const
+{
+    const auto* table = getLevel(mipLevel);
+
+    // Linear interpolation (the extra sample at the end of each level handles the wrap)
+    const float position = phaseInCycles * static_cast<float>(tableSize);
+    const int index = juce::jlimit(0, tableSize - 1, static_cast<int>(position));
+    const float fraction = position - static_cast<float>(index);
+
+    return table[index] + (table[index + 1] - table[index]) * fraction;
+}
+
+//==============================================================================
+FreOscWavetableLibrary::FreOscWavetableLibrary()
+{
+    // Fourier series of the raw waveforms in FreOscOscillator::generateWaveform,
+    // so the wavetable mode keeps the same phase and polarity
+    std::vector<float> cosine(static_cast<size_t>(FreOscWavetable::numHarmonics + 1));
+    std::vector<float> sine(static_cast<size_t>(FreOscWavetable::numHarmonics + 1));
+    constexpr float pi = juce::MathConstants<float>::pi;
+
+    auto build = [&](int waveformIndex, auto&& harmonicAmplitudes)
+    {
+        std::fill(cosine.begin(), cosine.end(), 0.0f);
+        std::fill(sine.begin(), sine.end(), 0.0f);
+
+        for (int harmonic = 1; harmonic <= FreOscWavetable::numHarmonics; ++harmonic)
+            harmonicAmplitudes(harmonic, cosine[static_cast<size_t>(harmonic)], sine[static_cast<size_t>(harmonic)]);
+
+        builtInTables[waveformIndex].buildFromHarmonics(cosine.data(), sine.data());
+    };
+
+    // Sine
+    build(0, [](int harmonic, float&, float& b) { b = harmonic == 1 ? 1.0f : 0.0f; });
+
+    // Square: +1 for the first half cycle, -1 for the second
+    build(1, [pi](int harmonic, float&, float& b) { b = (harmonic % 2 != 0) ? 4.0f / (pi * static_cast<float>(harmonic)) : 0.0f; });
+
+    // Sawtooth: rising from -1 to +1
+    build(2, [pi](int harmonic, float&, float& b) { b = -2.0f / (pi * static_cast<float>(harmonic)); });
+
+    // Triangle: -1 at the start of the cycle, +1 half way
+    build(3, [pi](int harmonic, float& a, float&)
+    {
+        const auto h = static_cast<float>(harmonic);
+        a = (harmonic % 2 != 0) ? -8.0f / (pi * pi * h * h) : 0.0f;
+    });
+}
+
+const FreOscWavetable& FreOscWavetableLibrary::getTable(int waveformIndex) const
+{
+    return builtInTables[juce::jlimit(0, numBuiltInTables - 1, waveformIndex)];
+}
@@ -0,0 +1,79 @@
+#pragma once
+
+#include <juce_audio_basics/juce_audio_basics.h>
+#include <juce_dsp/juce_dsp.h>
+#include <vector>
+
+//==============================================================================
+/**
+    FreOSC Wavetable
+
+    One single-cycle waveform stored as a set of band-limited mip levels.
+    Level 0 keeps harmonics up to tableSize / 2, every following level keeps
+    half as many, so a level can always be picked that has no harmonics above
+    Nyquist for the current phase increment.
+
+    Mip levels are chosen from the phase increment in cycles per sample, which
+    makes the tables independent of the sample rate.
+
+    Tables are built from harmonic coefficients or from any single-cycle
+    waveform (through juce::dsp::FFT), so user waveforms can be added
+    without changing the playback code.
+*/
+class FreOscWavetable
+{
+public:
+    //==============================================================================
+    static constexpr int fftOrder = 11;
+    static constexpr int tableSize = 1 << fftOrder;     // Samples per cycle
+    static constexpr int numHarmonics = tableSize / 2;
+    static constexpr int numMipLevels = fftOrder;       // numHarmonics, numHarmonics / 2, ..., 1
+
+    //==============================================================================
+    FreOscWavetable();
+
+    // cosineAmplitudes / sineAmplitudes: numHarmonics + 1 values, index = harmonic number (0 = DC)
+    void buildFromHarmonics(const float* cosineAmplitudes, const float* sineAmplitudes);
+
+    // Any single cycle, resampled to tableSize with linear interpolation
+    void buildFromSingleCycle(const float* samples, int numSamples);
+
+    //==============================================================================
+    // Playback - phase in cycles [0, 1), cyclesPerSample = phase increment
+    static int getMipLevel(float cyclesPerSample);
+    float getSample(int mipLevel, float phaseInCycles) const;
+
+private:
+    //==============================================================================
+    std::vector<float> tables; // numMipLevels * (tableSize + 1), last sample of each level wraps
+
+    const float* getLevel(int mipLevel) const { return tables.data() + mipLevel * (tableSize + 1); }
+
+    //==============================================================================
+    JUCE_LEAK_DETECTOR(FreOscWavetable)
+};
+
+//==============================================================================
+/**
+    The built-in Sine/Square/Sawtooth/Triangle wavetables, shared read-only
+    by every oscillator of every plugin instance through
+    juce::SharedResourcePointer. They are built when the first one is created.
+*/
+class FreOscWavetableLibrary
+{
+public:
+    //==============================================================================
+    FreOscWavetableLibrary();
+
+    // Index matches FreOscOscillator::Waveform
+    const FreOscWavetable& getTable(int waveformIndex) const;
+
+    static constexpr int numBuiltInTables = 4;
+
+private:
+    //==============================================================================
+    FreOscWavetable builtInTables[numBuiltInTables];
+
+    //==============================================================================
+    JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR(FreOscWavetableLibrary)
+};
@@ -22,6 +22,17 @@ juce::AudioProcessorValueTreeState::ParameterLayout FreOscParameters::createPara
     params.push_back(createIntParameter("osc2_octave", "Osc2 Octave", -2, 2, 0));
     params.push_back(createIntParameter("osc3_octave", "Osc3 Octave", -2, 2, -1));
 
+    // Unison copies per oscillator
+    params.push_back(createIntParameter("osc1_unison_voices", "Osc1 Unison Voices", 1, 8, 1));
+    params.push_back(createIntParameter("osc2_unison_voices", "Osc2 Unison Voices", 1, 8, 1));
+    params.push_back(createIntParameter("osc3_unison_voices", "Osc3 Unison Voices", 1, 8, 1));
+
+    // Partials per additive oscillator (before Nyquist culling)
+    params.push_back(createIntParameter("additive_partials", "Additive Partials", 1, 256, 64));
+
+    // Voice count (the voice pool always holds FreOscSynthesiser::maxVoices)
+    params.push_back(createIntParameter("polyphony", "Polyphony", 1, 128, 16));
+
     return { params.begin(), params.end() };
 }
 
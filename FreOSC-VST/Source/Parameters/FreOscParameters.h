@@ -20,15 +20,24 @@ public:
     //==============================================================================
     // Waveform choices
     static const juce::StringArray oscillatorWaveforms;
+    static const juce::StringArray oscillatorRenderModes;
     static const juce::StringArray noiseTypes;
     static const juce::StringArray filterTypes;
     static const juce::StringArray filterRouting;
+    static const juce::StringArray filterEngines;
     static const juce::StringArray effectsRouting;
     static const juce::StringArray pmCarriers;
+    static const juce::StringArray pmOversamplingFactors;
+    static const juce::StringArray fmAlgorithms;
     static const juce::StringArray lfoWaveforms;
     static const juce::StringArray lfoTargets;
     static const juce::StringArray modEnvelopeTargets;
     static const juce::StringArray envelopeModes;
+    static const juce::StringArray modulationRates;
+    static const juce::StringArray voiceEngines;
+    static const juce::StringArray renderThreads;
+    static const juce::StringArray renderWaitModes;
+    static const juce::StringArray trigPrecisions;
 
     //==============================================================================
     // Parameter ranges and defaults (matching JavaScript implementation)
@@ -74,6 +83,11 @@ inline const juce::StringArray FreOscParameters::oscillatorWaveforms = {
     "Sine", "Square", "Sawtooth", "Triangle"
 };
 
+// Oscillator render mode choices (naive, PolyBLEP, wavetable or additive waveforms)
+inline const juce::StringArray FreOscParameters::oscillatorRenderModes = {
+    "Raw", "PolyBLEP", "Wavetable", "Additive"
+};
+
 // Noise type choices (matching JavaScript implementation)
 inline const juce::StringArray FreOscParameters::noiseTypes = {
     "White", "Pink", "Brown", "Blue", "Violet", "Grey",
@@ -90,6 +104,11 @@ inline const juce::StringArray FreOscParameters::filterRouting = {
     "Filter 1 Only", "Parallel", "Series"
 };
 
+// Filter engine choices (RBJ biquad or zero-delay-feedback state variable filter)
+inline const juce::StringArray FreOscParameters::filterEngines = {
+    "Biquad", "State Variable"
+};
+
 // Effects routing choices
 inline const juce::StringArray FreOscParameters::effectsRouting = {
     "Wavefolder to Reverb to Delay", "Wavefolder to Delay to Reverb", "Wavefolder Parallel with Reverb+Delay"
@@ -101,6 +120,17 @@ inline const juce::StringArray FreOscParameters::pmCarriers = {
     "Oscillator 1", "Oscillator 2", "Both Osc 1 & 2"
 };
 
+// PM oscillator stage oversampling (applied only for high PM index)
+inline const juce::StringArray FreOscParameters::pmOversamplingFactors = {
+    "Off", "2x", "4x"
+};
+
+// FM operator algorithms ("a>b": operator a modulates b, see FreOscFMEngine)
+inline const juce::StringArray FreOscParameters::fmAlgorithms = {
+    "6>5>4>3>2>1", "2>1, 6>5>4>3", "3>2>1, 6>5>4", "2>1, 4+5>3, 6>5",
+    "2>1, 4>3, 6>5", "2>1, 6>3+4+5", "6>1+2+3+4+5", "Additive"
+};
+
 // LFO waveform choices
 inline const juce::StringArray FreOscParameters::lfoWaveforms = {
     "Sine", "Triangle", "Sawtooth", "Square", "Random"
@@ -121,6 +151,31 @@ inline const juce::StringArray FreOscParameters::envelopeModes = {
     "One-Shot", "Gate", "Looping"
 };
 
+// Modulation control-rate choices (samples between LFO/mod envelope evaluations)
+inline const juce::StringArray FreOscParameters::modulationRates = {
+    "Audio Rate", "8 Samples", "16 Samples", "32 Samples"
+};
+
+// Voice engine choices (SIMD bank falls back to Classic for modulated/PM patches)
+inline const juce::StringArray FreOscParameters::voiceEngines = {
+    "Classic", "SIMD Bank"
+};
+
+// Voice render thread choices (including the audio thread)
+inline const juce::StringArray FreOscParameters::renderThreads = {
+    "Serial", "2 Threads", "4 Threads", "8 Threads", "16 Threads"
+};
+
+// How voice render workers wait for the next block
+inline const juce::StringArray FreOscParameters::renderWaitModes = {
+    "Spin", "Yield", "Block"
+};
+
+// Sine/cosine evaluation for oscillators, LFOs and panning (see FreOscFastMath)
+inline const juce::StringArray FreOscParameters::trigPrecisions = {
+    "Exact", "Polynomial", "Table"
+};
+
 //==============================================================================
 // Float parameter definitions with ranges matching JavaScript implementation
 inline const std::vector<FreOscParameters::ParameterInfo> FreOscParameters::floatParameters = {
@@ -128,16 +183,25 @@ inline const std::vector<FreOscParameters::ParameterInfo> FreOscParameters::floa
     {"osc1_level",     "Osc1 Level",     {0.0f, 1.0f, 0.01f}, 0.5f},
     {"osc1_detune",    "Osc1 Detune",    {-50.0f, 50.0f, 1.0f}, 0.0f, " cents"},
     {"osc1_pan",       "Osc1 Pan",       {-1.0f, 1.0f, 0.01f}, 0.0f},
+    {"osc1_unison_detune", "Osc1 Unison Detune", {0.0f, 100.0f, 0.1f}, 25.0f, " cents"},
+    {"osc1_unison_spread", "Osc1 Unison Spread", {0.0f, 1.0f, 0.01f}, 0.5f},
 
     // Oscillator 2 - Off by default
     {"osc2_level",     "Osc2 Level",     {0.0f, 1.0f, 0.01f}, 0.0f},
     {"osc2_detune",    "Osc2 Detune",    {-50.0f, 50.0f, 1.0f}, 0.0f, " cents"},
     {"osc2_pan",       "Osc2 Pan",       {-1.0f, 1.0f, 0.01f}, 0.0f},
+    {"osc2_unison_detune", "Osc2 Unison Detune", {0.0f, 100.0f, 0.1f}, 25.0f, " cents"},
+    {"osc2_unison_spread", "Osc2 Unison Spread", {0.0f, 1.0f, 0.01f}, 0.5f},
 
     // Oscillator 3 - Off by default
     {"osc3_level",     "Osc3 Level",     {0.0f, 1.0f, 0.01f}, 0.0f},
     {"osc3_detune",    "Osc3 Detune",    {-50.0f, 50.0f, 1.0f}, 0.0f, " cents"},
     {"osc3_pan",       "Osc3 Pan",       {-1.0f, 1.0f, 0.01f}, 0.0f},
+    {"osc3_unison_detune", "Osc3 Unison Detune", {0.0f, 100.0f, 0.1f}, 25.0f, " cents"},
+    {"osc3_unison_spread", "Osc3 Unison Spread", {0.0f, 1.0f, 0.01f}, 0.5f},
+
+    // Additive render mode - spectral tilt shared by all additive oscillators (0.5 = plain waveform)
+    {"additive_brightness", "Additive Brightness", {0.0f, 1.0f, 0.01f}, 0.5f},
 
     // Noise - Off by default
     {"noise_level",    "Noise Level",    {0.0f, 1.0f, 0.01f}, 0.0f},
@@ -166,6 +230,46 @@ inline const std::vector<FreOscParameters::ParameterInfo> FreOscParameters::floa
     {"pm_index",         "PM Index",    {0.0f, 10.0f, 0.01f}, 0.0f},
     {"pm_ratio",         "PM Ratio",    {0.1f, 8.0f, 0.1f}, 1.0f},
 
+    // FM operator engine - Off by default (operator 1 alone is a plain sine)
+    {"fm_level",         "FM Level",    {0.0f, 1.0f, 0.01f}, 0.0f},
+    {"fm_feedback",      "FM Feedback", {0.0f, 1.0f, 0.01f}, 0.0f},
+    {"fm_op1_ratio",    "FM Op1 Ratio",    {0.5f, 16.0f, 0.01f, 0.4f}, 1.0f},
+    {"fm_op1_level",    "FM Op1 Level",    {0.0f, 1.0f, 0.01f}, 1.0f},
+    {"fm_op1_attack",   "FM Op1 Attack",   {0.0f, 6.0f, 0.01f}, 0.0f, " s"},
+    {"fm_op1_decay",    "FM Op1 Decay",    {0.0f, 6.0f, 0.01f}, 0.3f, " s"},
+    {"fm_op1_sustain",  "FM Op1 Sustain",  {0.0f, 1.0f, 0.01f}, 1.0f},
+    {"fm_op1_release",  "FM Op1 Release",  {0.0f, 6.0f, 0.01f}, 0.3f, " s"},
+    {"fm_op2_ratio",    "FM Op2 Ratio",    {0.5f, 16.0f, 0.01f, 0.4f}, 1.0f},
+    {"fm_op2_level",    "FM Op2 Level",    {0.0f, 1.0f, 0.01f}, 0.0f},
+    {"fm_op2_attack",   "FM Op2 Attack",   {0.0f, 6.0f, 0.01f}, 0.0f, " s"},
+    {"fm_op2_decay",    "FM Op2 Decay",    {0.0f, 6.0f, 0.01f}, 0.3f, " s"},
+    {"fm_op2_sustain",  "FM Op2 Sustain",  {0.0f, 1.0f, 0.01f}, 1.0f},
+    {"fm_op2_release",  "FM Op2 Release",  {0.0f, 6.0f, 0.01f}, 0.3f, " s"},
+    {"fm_op3_ratio",    "FM Op3 Ratio",    {0.5f, 16.0f, 0.01f, 0.4f}, 1.0f},
+    {"fm_op3_level",    "FM Op3 Level",    {0.0f, 1.0f, 0.01f}, 0.0f},
+    {"fm_op3_attack",   "FM Op3 Attack",   {0.0f, 6.0f, 0.01f}, 0.0f, " s"},
+    {"fm_op3_decay",    "FM Op3 Decay",    {0.0f, 6.0f, 0.01f}, 0.3f, " s"},
+    {"fm_op3_sustain",  "FM Op3 Sustain",  {0.0f, 1.0f, 0.01f}, 1.0f},
+    {"fm_op3_release",  "FM Op3 Release",  {0.0f, 6.0f, 0.01f}, 0.3f, " s"},
+    {"fm_op4_ratio",    "FM Op4 Ratio",    {0.5f, 16.0f, 0.01f, 0.4f}, 1.0f},
+    {"fm_op4_level",    "FM Op4 Level",    {0.0f, 1.0f, 0.01f}, 0.0f},
+    {"fm_op4_attack",   "FM Op4 Attack",   {0.0f, 6.0f, 0.01f}, 0.0f, " s"},
+    {"fm_op4_decay",    "FM Op4 Decay",    {0.0f, 6.0f, 0.01f}, 0.3f, " s"},
+    {"fm_op4_sustain",  "FM Op4 Sustain",  {0.0f, 1.0f, 0.01f}, 1.0f},
+    {"fm_op4_release",  "FM Op4 Release",  {0.0f, 6.0f, 0.01f}, 0.3f, " s"},
+    {"fm_op5_ratio",    "FM Op5 Ratio",    {0.5f, 16.0f, 0.01f, 0.4f}, 1.0f},
+    {"fm_op5_level",    "FM Op5 Level",    {0.0f, 1.0f, 0.01f}, 0.0f},
+    {"fm_op5_attack",   "FM Op5 Attack",   {0.0f, 6.0f, 0.01f}, 0.0f, " s"},
+    {"fm_op5_decay",    "FM Op5 Decay",    {0.0f, 6.0f, 0.01f}, 0.3f, " s"},
+    {"fm_op5_sustain",  "FM Op5 Sustain",  {0.0f, 1.0f, 0.01f}, 1.0f},
+    {"fm_op5_release",  "FM Op5 Release",  {0.0f, 6.0f, 0.01f}, 0.3f, " s"},
+    {"fm_op6_ratio",    "FM Op6 Ratio",    {0.5f, 16.0f, 0.01f, 0.4f}, 1.0f},
+    {"fm_op6_level",    "FM Op6 Level",    {0.0f, 1.0f, 0.01f}, 0.0f},
+    {"fm_op6_attack",   "FM Op6 Attack",   {0.0f, 6.0f, 0.01f}, 0.0f, " s"},
+    {"fm_op6_decay",    "FM Op6 Decay",    {0.0f, 6.0f, 0.01f}, 0.3f, " s"},
+    {"fm_op6_sustain",  "FM Op6 Sustain",  {0.0f, 1.0f, 0.01f}, 1.0f},
+    {"fm_op6_release",  "FM Op6 Release",  {0.0f, 6.0f, 0.01f}, 0.3f, " s"},
+
     // Clean Dynamics - Professional compressor and limiter
     {"comp_threshold",   "Comp Threshold",  {-60.0f, 0.0f, 0.1f}, -12.0f, " dB"},
     {"comp_ratio",       "Comp Ratio",      {1.0f, 20.0f, 0.1f}, 4.0f, ":1"},
@@ -228,7 +332,10 @@ inline const std::vector<FreOscParameters::ParameterInfo> FreOscParameters::floa
     {"wavefolder_threshold", "Wavefolder Threshold", {0.0f, 1.0f, 0.01f}, 0.6f},
     {"wavefolder_symmetry",  "Wavefolder Symmetry",  {0.0f, 1.0f, 0.01f}, 0.0f},
     {"wavefolder_mix",       "Wavefolder Mix",       {0.0f, 1.0f, 0.01f}, 0.0f},
-    {"wavefolder_output",    "Wavefolder Output",    {0.0f, 1.0f, 0.01f}, 0.5f}
+    {"wavefolder_output",    "Wavefolder Output",    {0.0f, 1.0f, 0.01f}, 0.5f},
+
+    // Voice retirement - releasing voices below this output level are freed early
+    {"voice_retire_threshold", "Voice Retire Threshold", {-120.0f, -48.0f, 0.1f}, -96.0f, " dB"}
 };
 
 //==============================================================================
@@ -239,6 +346,11 @@ inline const std::vector<std::tuple<juce::String, juce::String, juce::StringArra
     {"osc2_waveform", "Osc2 Waveform", oscillatorWaveforms, 0}, // Sine
     {"osc3_waveform", "Osc3 Waveform", oscillatorWaveforms, 0}, // Sine
 
+    // Render modes - Raw, so sessions and presets saved before the setting existed sound unchanged
+    {"osc1_render_mode", "Osc1 Render Mode", oscillatorRenderModes, 0}, // Raw
+    {"osc2_render_mode", "Osc2 Render Mode", oscillatorRenderModes, 0}, // Raw
+    {"osc3_render_mode", "Osc3 Render Mode", oscillatorRenderModes, 0}, // Raw
+
     // Noise type
     {"noise_type", "Noise Type", noiseTypes, 0}, // White
 
@@ -246,10 +358,15 @@ inline const std::vector<std::tuple<juce::String, juce::String, juce::StringArra
     {"filter_type", "Filter Type", filterTypes, 0}, // Low Pass
     {"filter2_type", "Filter2 Type", filterTypes, 2}, // Band Pass for complementary filtering
     {"filter_routing", "Filter Routing", filterRouting, 0}, // Off
+    {"filter_engine", "Filter Engine", filterEngines, 0}, // Biquad
     {"effects_routing", "Effects Routing", effectsRouting, 0}, // Series Reverb to Delay
 
     // PM - OSC3 is always the message signal, user selects carrier(s)
     {"pm_carrier", "PM Carrier", pmCarriers, 0}, // Oscillator 1
+    {"pm_oversampling", "PM Oversampling", pmOversamplingFactors, 1}, // 2x (only above the index threshold)
+
+    // FM operator engine
+    {"fm_algorithm", "FM Algorithm", fmAlgorithms, 0}, // 6 operator stack
 
     // LFO 1
     {"lfo_waveform", "LFO Waveform", lfoWaveforms, 0}, // Sine
@@ -267,5 +384,16 @@ inline const std::vector<std::tuple<juce::String, juce::String, juce::StringArra
     {"mod_env1_target", "ModEnv1 Target", modEnvelopeTargets, 0}, // None
     {"mod_env2_target", "ModEnv2 Target", modEnvelopeTargets, 0}, // None
     {"mod_env1_mode", "ModEnv1 Mode", envelopeModes, 1}, // Gate (for backward compatibility)
-    {"mod_env2_mode", "ModEnv2 Mode", envelopeModes, 1}  // Gate (for backward compatibility)
+    {"mod_env2_mode", "ModEnv2 Mode", envelopeModes, 1}, // Gate (for backward compatibility)
+
+    // Modulation quality - LFO/mod envelope control rate
+    {"mod_control_rate", "Mod Control Rate", modulationRates, 2}, // 16 Samples
+    {"trig_precision", "Trig Precision", trigPrecisions, 1}, // Polynomial
+
+    // Voice engine
+    {"voice_engine", "Voice Engine", voiceEngines, 0}, // Classic
+
+    // Multi-core voice rendering
+    {"render_threads", "Render Threads", renderThreads, 0}, // Serial
+    {"render_wait_mode", "Render Wait Mode", renderWaitModes, 1} // Yield
 };
\ No newline at end of file
@@ -3,6 +3,100 @@
 #include <cmath>
 #include <algorithm>
 
+namespace
+{
+    struct ParameterEntry
+    {
+        const char* id;
+        int group;
+    };
+
+    // Voice parameter IDs in VoiceParameterIndex order, with their snapshot group
+    const ParameterEntry voiceParameterEntries[] =
+    {
+        { "osc1_waveform", FreOscVoiceParameters::OscillatorGroup }, { "osc1_octave", FreOscVoiceParameters::OscillatorGroup },
+        { "osc1_level", FreOscVoiceParameters::OscillatorGroup }, { "osc1_detune", FreOscVoiceParameters::OscillatorGroup },
+        { "osc1_pan", FreOscVoiceParameters::OscillatorGroup },
+        { "osc2_waveform", FreOscVoiceParameters::OscillatorGroup }, { "osc2_octave", FreOscVoiceParameters::OscillatorGroup },
+        { "osc2_level", FreOscVoiceParameters::OscillatorGroup }, { "osc2_detune", FreOscVoiceParameters::OscillatorGroup },
+        { "osc2_pan", FreOscVoiceParameters::OscillatorGroup },
+        { "osc3_waveform", FreOscVoiceParameters::OscillatorGroup }, { "osc3_octave", FreOscVoiceParameters::OscillatorGroup },
+        { "osc3_level", FreOscVoiceParameters::OscillatorGroup }, { "osc3_detune", FreOscVoiceParameters::OscillatorGroup },
+        { "osc3_pan", FreOscVoiceParameters::OscillatorGroup },
+        { "noise_type", FreOscVoiceParameters::NoiseGroup }, { "noise_level", FreOscVoiceParameters::NoiseGroup },
+        { "noise_pan", FreOscVoiceParameters::NoiseGroup },
+        { "envelope_attack", FreOscVoiceParameters::EnvelopeGroup }, { "envelope_decay", FreOscVoiceParameters::EnvelopeGroup },
+        { "envelope_sustain", FreOscVoiceParameters::EnvelopeGroup }, { "envelope_release", FreOscVoiceParameters::EnvelopeGroup },
+        { "pm_index", FreOscVoiceParameters::PMGroup }, { "pm_carrier", FreOscVoiceParameters::PMGroup },
+        { "pm_ratio", FreOscVoiceParameters::PMGroup },
+        { "lfo_waveform", FreOscVoiceParameters::LFOGroup }, { "lfo_rate", FreOscVoiceParameters::LFOGroup },
+        { "lfo_target", FreOscVoiceParameters::LFOGroup }, { "lfo_amount", FreOscVoiceParameters::LFOGroup },
+        { "lfo2_waveform", FreOscVoiceParameters::LFOGroup }, { "lfo2_rate", FreOscVoiceParameters::LFOGroup },
+        { "lfo2_target", FreOscVoiceParameters::LFOGroup }, { "lfo2_amount", FreOscVoiceParameters::LFOGroup },
+        { "lfo3_waveform", FreOscVoiceParameters::LFOGroup }, { "lfo3_rate", FreOscVoiceParameters::LFOGroup },
+        { "lfo3_target", FreOscVoiceParameters::LFOGroup }, { "lfo3_amount", FreOscVoiceParameters::LFOGroup },
+        { "filter_type", FreOscVoiceParameters::FilterGroup }, { "filter_cutoff", FreOscVoiceParameters::FilterGroup },
+        { "filter_resonance", FreOscVoiceParameters::FilterGroup }, { "filter_gain", FreOscVoiceParameters::FilterGroup },
+        { "filter2_type", FreOscVoiceParameters::Filter2Group }, { "filter2_cutoff", FreOscVoiceParameters::Filter2Group },
+        { "filter2_resonance", FreOscVoiceParameters::Filter2Group }, { "filter2_gain", FreOscVoiceParameters::Filter2Group },
+        { "mod_env1_attack", FreOscVoiceParameters::ModEnv1Group }, { "mod_env1_decay", FreOscVoiceParameters::ModEnv1Group },
+        { "mod_env1_sustain", FreOscVoiceParameters::ModEnv1Group }, { "mod_env1_release", FreOscVoiceParameters::ModEnv1Group },
+        { "mod_env1_amount", FreOscVoiceParameters::ModEnv1Group }, { "mod_env1_target", FreOscVoiceParameters::ModEnv1Group },
+        { "mod_env1_mode", FreOscVoiceParameters::ModEnv1Group }, { "mod_env1_rate", FreOscVoiceParameters::ModEnv1Group },
+        { "mod_env2_attack", FreOscVoiceParameters::ModEnv2Group }, { "mod_env2_decay", FreOscVoiceParameters::ModEnv2Group },
+        { "mod_env2_sustain", FreOscVoiceParameters::ModEnv2Group }, { "mod_env2_release", FreOscVoiceParameters::ModEnv2Group },
+        { "mod_env2_amount", FreOscVoiceParameters::ModEnv2Group }, { "mod_env2_target", FreOscVoiceParameters::ModEnv2Group },
+        { "mod_env2_mode", FreOscVoiceParameters::ModEnv2Group }, { "mod_env2_rate", FreOscVoiceParameters::ModEnv2Group },
+        { "filter_routing", FreOscVoiceParameters::GlobalGroup }, { "mod_control_rate", FreOscVoiceParameters::GlobalGroup },
+        { "voice_retire_threshold", FreOscVoiceParameters::GlobalGroup },
+        { "osc1_render_mode", FreOscVoiceParameters::OscillatorGroup }, { "osc2_render_mode", FreOscVoiceParameters::OscillatorGroup },
+        { "osc3_render_mode", FreOscVoiceParameters::OscillatorGroup },
+        { "trig_precision", FreOscVoiceParameters::GlobalGroup },
+        { "osc1_unison_voices", FreOscVoiceParameters::OscillatorGroup }, { "osc1_unison_detune", FreOscVoiceParameters::OscillatorGroup },
+        { "osc1_unison_spread", FreOscVoiceParameters::OscillatorGroup },
+        { "osc2_unison_voices", FreOscVoiceParameters::OscillatorGroup }, { "osc2_unison_detune", FreOscVoiceParameters::OscillatorGroup },
+        { "osc2_unison_spread", FreOscVoiceParameters::OscillatorGroup },
+        { "osc3_unison_voices", FreOscVoiceParameters::OscillatorGroup }, { "osc3_unison_detune", FreOscVoiceParameters::OscillatorGroup },
+        { "osc3_unison_spread", FreOscVoiceParameters::OscillatorGroup },
+        { "pm_oversampling", FreOscVoiceParameters::PMGroup },
+        { "fm_algorithm", FreOscVoiceParameters::FMGroup }, { "fm_level", FreOscVoiceParameters::FMGroup },
+        { "fm_feedback", FreOscVoiceParameters::FMGroup },
+        { "fm_op1_ratio", FreOscVoiceParameters::FMGroup }, { "fm_op1_level", FreOscVoiceParameters::FMGroup },
+        { "fm_op1_attack", FreOscVoiceParameters::FMGroup }, { "fm_op1_decay", FreOscVoiceParameters::FMGroup },
+        { "fm_op1_sustain", FreOscVoiceParameters::FMGroup }, { "fm_op1_release", FreOscVoiceParameters::FMGroup },
+        { "fm_op2_ratio", FreOscVoiceParameters::FMGroup }, { "fm_op2_level", FreOscVoiceParameters::FMGroup },
+        { "fm_op2_attack", FreOscVoiceParameters::FMGroup }, { "fm_op2_decay", FreOscVoiceParameters::FMGroup },
+        { "fm_op2_sustain", FreOscVoiceParameters::FMGroup }, { "fm_op2_release", FreOscVoiceParameters::FMGroup },
+        { "fm_op3_ratio", FreOscVoiceParameters::FMGroup }, { "fm_op3_level", FreOscVoiceParameters::FMGroup },
+        { "fm_op3_attack", FreOscVoiceParameters::FMGroup }, { "fm_op3_decay", FreOscVoiceParameters::FMGroup },
+        { "fm_op3_sustain", FreOscVoiceParameters::FMGroup }, { "fm_op3_release", FreOscVoiceParameters::FMGroup },
+        { "fm_op4_ratio", FreOscVoiceParameters::FMGroup }, { "fm_op4_level", FreOscVoiceParameters::FMGroup },
+        { "fm_op4_attack", FreOscVoiceParameters::FMGroup }, { "fm_op4_decay", FreOscVoiceParameters::FMGroup },
+        { "fm_op4_sustain", FreOscVoiceParameters::FMGroup }, { "fm_op4_release", FreOscVoiceParameters::FMGroup },
+        { "fm_op5_ratio", FreOscVoiceParameters::FMGroup }, { "fm_op5_level", FreOscVoiceParameters::FMGroup },
+        { "fm_op5_attack", FreOscVoiceParameters::FMGroup }, { "fm_op5_decay", FreOscVoiceParameters::FMGroup },
+        { "fm_op5_sustain", FreOscVoiceParameters::FMGroup }, { "fm_op5_release", FreOscVoiceParameters::FMGroup },
+        { "fm_op6_ratio", FreOscVoiceParameters::FMGroup }, { "fm_op6_level", FreOscVoiceParameters::FMGroup },
+        { "fm_op6_attack", FreOscVoiceParameters::FMGroup }, { "fm_op6_decay", FreOscVoiceParameters::FMGroup },
+        { "fm_op6_sustain", FreOscVoiceParameters::FMGroup }, { "fm_op6_release", FreOscVoiceParameters::FMGroup },
+        { "filter_engine", FreOscVoiceParameters::GlobalGroup }
+    };
+
+    // Effect parameter IDs in EffectParameterIndex order, grouped by effects chain index
+    const ParameterEntry effectParameterEntries[] =
+    {
+        { "comp_threshold", 0 }, { "comp_ratio", 0 }, { "comp_attack", 0 }, { "comp_release", 0 },
+        { "comp_makeup", 0 }, { "comp_mix", 0 },
+        { "limiter_threshold", 1 }, { "limiter_release", 1 }, { "limiter_ceiling", 1 }, { "limiter_saturation", 1 },
+        { "plate_predelay", 2 }, { "plate_size", 2 }, { "plate_damping", 2 }, { "plate_diffusion", 2 },
+        { "plate_wet_level", 2 }, { "plate_width", 2 },
+        { "tape_time", 3 }, { "tape_feedback", 3 }, { "tape_tone", 3 }, { "tape_flutter", 3 },
+        { "tape_wet_level", 3 }, { "tape_width", 3 },
+        { "wavefolder_drive", 4 }, { "wavefolder_threshold", 4 }, { "wavefolder_symmetry", 4 },
+        { "wavefolder_mix", 4 }, { "wavefolder_output", 4 }
+    };
+}
+
 //==============================================================================
 FreOscProcessor::FreOscProcessor()
 #ifndef JucePlugin_PreferredChannelConfigurations
@@ -17,6 +111,9 @@ FreOscProcessor::FreOscProcessor()
 #endif
        parameters(*this, nullptr, "Parameters", FreOscParameters::createParameterLayout())
 {
+    // Resolve parameter handles once
+    initializeParameterHandles();
+
     // Initialize synthesizer
     initializeSynthesiser();
 
@@ -136,8 +233,29 @@ void FreOscProcessor::prepareToPlay (double sampleRate, int samplesPerBlock)
     currentSampleRate = sampleRate;
     currentBlockSize = samplesPerBlock;
 
+    // Filter tables first - voices design their filters from them while preparing
+    filterTables.prepare(sampleRate);
+
+    // Shared filter coefficients are keyed by sample rate, so republish every group
+    juce::dsp::ProcessSpec designSpec { sampleRate, static_cast<juce::uint32>(samplesPerBlock), 1 };
+    for (auto& designer : filterDesigners)
+    {
+        designer.setTables(&filterTables);
+        designer.prepare(designSpec);
+    }
+    voiceParametersNeedFullUpdate = true;
+
     // Prepare synthesizer
+    allocateVoicePool();
     synthesiser.setCurrentPlaybackSampleRate(sampleRate);
+    synthesiser.prepareRenderer(sampleRate, samplesPerBlock);
+    voiceBank.setFilterTables(&filterTables);
+    voiceBank.prepare(sampleRate);
+    bankSynthesiser.setCurrentPlaybackSampleRate(sampleRate);
+
+    // Room for a busy block of MIDI on each engine, so splitting never allocates
+    classicMidi.ensureSize(4096);
+    bankMidi.ensureSize(4096);
 
     // Prepare effects chain
     juce::dsp::ProcessSpec spec;
@@ -152,7 +270,7 @@ void FreOscProcessor::prepareToPlay (double sampleRate, int samplesPerBlock)
     
     // Initialize master volume smoothing
     masterVolumeSmooth.reset(sampleRate, 0.05); // 50ms ramp time
-    float initialMasterVolNormalized = parameters.getRawParameterValue(ParameterIDs::masterVolume)->load();
+    float initialMasterVolNormalized = masterVolumeParameter->load();
     float initialMasterVol = normalizedToMasterGain(initialMasterVolNormalized);
     masterVolumeSmooth.setCurrentAndTargetValue(initialMasterVol);
 
@@ -165,6 +283,7 @@ void FreOscProcessor::releaseResources()
     // When playback stops, you can use this as an opportunity to free up any
     // spare memory, etc.
     effectsChain.reset();
+    synthesiser.releaseRenderer();
 }
 
 #ifndef JucePlugin_PreferredChannelConfigurations
@@ -194,6 +313,9 @@ bool FreOscProcessor::isBusesLayoutSupported (const BusesLayout& layouts) const
 void FreOscProcessor::processBlock (juce::AudioBuffer<float>& buffer, juce::MidiBuffer& midiMessages)
 {
     juce::ScopedNoDenormals noDenormals;
+    FREOSC_PROFILE_STAGE(&profilingStats, ProcessBlock);
+    FREOSC_PROFILE_BLOCK(&profilingStats, buffer.getNumSamples());
+
     auto totalNumInputChannels  = getTotalNumInputChannels();
     auto totalNumOutputChannels = getTotalNumOutputChannels();
 
@@ -205,13 +327,39 @@ void FreOscProcessor::processBlock (juce::AudioBuffer<float>& buffer, juce::Midi
     updateVoiceParameters();
     updateEffectsParameters();
 
+    // Additive spectra: ask for a rebuild if the settings moved, then pick up the latest finished set
+    additiveProfiles.requestProfiles(static_cast<int>(additivePartialsParameter->load()), additiveBrightnessParameter->load());
+    additiveProfiles.acquireLatest();
+
     // Clear the buffer first (synthesizer will add to it)
     buffer.clear();
 
     // Remove the forced silence check - let synthesizer handle voice management naturally
 
-    // Render synthesizer (filtering now happens per-voice)
-    synthesiser.renderNextBlock(buffer, midiMessages, 0, buffer.getNumSamples());
+    // Voice render threads: Serial, 2, 4, 8 or 16
+    static constexpr int renderThreadCounts[] = { 1, 2, 4, 8, 16 };
+    auto& renderer = synthesiser.getRenderer();
+    renderer.setNumThreads(renderThreadCounts[juce::jlimit(0, 4, static_cast<int>(renderThreadsParameter->load()))]);
+    renderer.setWaitStrategy(static_cast<FreOscParallelVoiceRenderer::WaitStrategy>(juce::jlimit(0, 2, static_cast<int>(renderWaitModeParameter->load()))));
+
+    // Polyphony limit within the preallocated voice pools
+    const int voiceLimit = static_cast<int>(polyphonyParameter->load());
+    synthesiser.setVoiceLimit(voiceLimit);
+    bankSynthesiser.setVoiceLimit(voiceLimit);
+
+    // Pick the voice engine for new notes - the SIMD bank only renders unmodulated patches
+    const bool useVoiceBank = static_cast<int>(voiceEngineParameter->load()) == 1
+                           && FreOscVoiceBank::supportsParameters(voiceParameterSnapshots[publishedSnapshotIndex]);
+
+    splitMidiByEngine(midiMessages, useVoiceBank);
+
+    // Render synthesizer (filtering now happens per-voice); notes finish on
+    // the engine they started on
+    {
+        FREOSC_PROFILE_STAGE(&profilingStats, Voices);
+        synthesiser.renderNextBlock(buffer, classicMidi, 0, buffer.getNumSamples());
+        bankSynthesiser.renderNextBlock(buffer, bankMidi, 0, buffer.getNumSamples());
+    }
 
     // Process through global effects chain with routing support
     // Filter processing now happens inside each voice
@@ -221,15 +369,16 @@ void FreOscProcessor::processBlock (juce::AudioBuffer<float>& buffer, juce::Midi
     // Always apply clean compressor and limiter first
     auto& compressor = effectsChain.get<0>();
     auto& limiter = effectsChain.get<1>();
-    compressor.process(context);
-    limiter.process(context);
+    processEffect(FreOscProfilingStats::Compressor, compressor, context);
+    processEffect(FreOscProfilingStats::Limiter, limiter, context);
     
     // Apply effects routing based on parameter
-    auto effectsRouting = static_cast<int>(parameters.getRawParameterValue("effects_routing")->load());
+    auto effectsRouting = static_cast<int>(effectsRoutingParameter->load());
     processEffectsWithRouting(context, effectsRouting);
 
     // Apply smoothed master volume to prevent pops
-    float targetMasterVolNormalized = parameters.getRawParameterValue(ParameterIDs::masterVolume)->load();
+    FREOSC_PROFILE_STAGE(&profilingStats, MasterGain);
+    float targetMasterVolNormalized = masterVolumeParameter->load();
     float targetMasterVol = normalizedToMasterGain(targetMasterVolNormalized);
     masterVolumeSmooth.setTargetValue(targetMasterVol);
     
@@ -282,16 +431,115 @@ void FreOscProcessor::setStateInformation (const void* data, int sizeInBytes)
 }
 
 //==============================================================================
-void FreOscProcessor::initializeSynthesiser()
+void FreOscProcessor::initializeParameterHandles()
 {
-    // Add voices (16 voice polyphony)
-    for (int i = 0; i < 16; ++i)
+    static_assert(std::size(voiceParameterEntries) == NumVoiceParameters, "Voice parameter table out of sync");
+    static_assert(std::size(effectParameterEntries) == NumEffectParameters, "Effect parameter table out of sync");
+
+    auto resolve = [this](CachedParameter& handle, const ParameterEntry& entry)
     {
-        synthesiser.addVoice(new FreOscVoice());
+        handle.value = parameters.getRawParameterValue(entry.id);
+        handle.group = entry.group;
+        jassert(handle.value != nullptr); // Parameter ID missing from the layout
+    };
+
+    for (int i = 0; i < NumVoiceParameters; ++i)
+        resolve(voiceParameterHandles[i], voiceParameterEntries[i]);
+
+    for (int i = 0; i < NumEffectParameters; ++i)
+        resolve(effectParameterHandles[i], effectParameterEntries[i]);
+
+    effectsRoutingParameter = parameters.getRawParameterValue("effects_routing");
+    masterVolumeParameter = parameters.getRawParameterValue(ParameterIDs::masterVolume);
+    voiceEngineParameter = parameters.getRawParameterValue("voice_engine");
+    renderThreadsParameter = parameters.getRawParameterValue("render_threads");
+    renderWaitModeParameter = parameters.getRawParameterValue("render_wait_mode");
+    polyphonyParameter = parameters.getRawParameterValue("polyphony");
+    additivePartialsParameter = parameters.getRawParameterValue("additive_partials");
+    additiveBrightnessParameter = parameters.getRawParameterValue("additive_brightness");
+}
+
+juce::uint32 FreOscProcessor::pollChangedGroups(CachedParameter* handles, int numHandles, bool forceAll)
+{
+    // Returns a bit mask of the groups containing a parameter that moved since the last poll
+    juce::uint32 changedGroups = 0;
+
+    for (int i = 0; i < numHandles; ++i)
+    {
+        auto& handle = handles[i];
+        const float value = handle.value->load(std::memory_order_relaxed);
+
+        if (forceAll || value != handle.lastValue)
+        {
+            handle.lastValue = value;
+            changedGroups |= (1u << handle.group);
+        }
     }
 
+    return changedGroups;
+}
+
+void FreOscProcessor::initializeSynthesiser()
+{
+    // Voices are allocated in prepareToPlay (see allocateVoicePool)
+
     // Add sound - FreOSC uses one sound type for all notes
     synthesiser.addSound(new FreOscSound());
+
+    // SIMD bank engine - one voice per bank lane
+    bankSynthesiser.createVoices();
+    bankSynthesiser.addSound(new FreOscSound());
+}
+
+void FreOscProcessor::allocateVoicePool()
+{
+    // Allocate the whole pool once; the polyphony parameter only limits how
+    // many of these voices may play, so changing it never allocates
+    while (synthesiser.getNumVoices() < FreOscSynthesiser::maxVoices)
+    {
+        auto* voice = new FreOscVoice();
+        voice->setParameters(voiceParameterSnapshots[publishedSnapshotIndex]);
+        voice->setProfilingStats(&profilingStats, synthesiser.getNumVoices());
+        voice->setAdditiveProfiles(&additiveProfiles);
+        voice->setFilterTables(&filterTables);
+        synthesiser.addVoice(voice);
+    }
+}
+
+void FreOscProcessor::splitMidiByEngine(const juce::MidiBuffer& midiMessages, bool useVoiceBank)
+{
+    classicMidi.clear();
+    bankMidi.clear();
+
+    for (const auto metadata : midiMessages)
+    {
+        const auto message = metadata.getMessage();
+        const int channel = message.getChannel();
+
+        if (message.isNoteOnOrOff() && juce::isPositiveAndBelow(channel - 1, 16))
+        {
+            auto& onVoiceBank = notesOnVoiceBank[channel - 1][message.getNoteNumber()];
+
+            if (message.isNoteOn())
+            {
+                // A note retriggered on the other engine stops there first, as
+                // juce::Synthesiser does for a note that is still ringing
+                if (onVoiceBank != useVoiceBank)
+                    (onVoiceBank ? bankMidi : classicMidi).addEvent(juce::MidiMessage::noteOff(channel, message.getNoteNumber()),
+                                                                    metadata.samplePosition);
+
+                onVoiceBank = useVoiceBank;
+            }
+
+            (onVoiceBank ? bankMidi : classicMidi).addEvent(message, metadata.samplePosition);
+        }
+        else
+        {
+            // Controllers, pitch wheel and pedals apply to the notes on both engines
+            classicMidi.addEvent(message, metadata.samplePosition);
+            bankMidi.addEvent(message, metadata.samplePosition);
+        }
+    }
 }
 
 void FreOscProcessor::setupEffectsChain()
@@ -320,153 +568,278 @@ void FreOscProcessor::setupEffectsChain()
 
 void FreOscProcessor::updateVoiceParameters()
 {
+    // Nothing to publish while no parameter has moved
+    const auto changedGroups = pollChangedGroups(voiceParameterHandles, NumVoiceParameters, voiceParametersNeedFullUpdate);
+    voiceParametersNeedFullUpdate = false;
+
+    if (changedGroups == 0)
+        return;
+
+    // Fill the snapshot the voices are not currently reading, then publish it
+    const auto& published = voiceParameterSnapshots[publishedSnapshotIndex];
+    auto& snapshot = voiceParameterSnapshots[1 - publishedSnapshotIndex];
+
+    auto value = [this](VoiceParameterIndex index) { return voiceParameterHandles[index].lastValue; };
+    auto choice = [this](VoiceParameterIndex index) { return static_cast<int>(voiceParameterHandles[index].lastValue); };
+
     // Get current parameter values
-    auto osc1Waveform = static_cast<int>(parameters.getRawParameterValue("osc1_waveform")->load());
-    auto osc1Octave = static_cast<int>(parameters.getRawParameterValue("osc1_octave")->load());
-    auto osc1Level = parameters.getRawParameterValue("osc1_level")->load();
-    auto osc1Detune = parameters.getRawParameterValue("osc1_detune")->load();
-    auto osc1Pan = parameters.getRawParameterValue("osc1_pan")->load();
-
-    auto osc2Waveform = static_cast<int>(parameters.getRawParameterValue("osc2_waveform")->load());
-    auto osc2Octave = static_cast<int>(parameters.getRawParameterValue("osc2_octave")->load());
-    auto osc2Level = parameters.getRawParameterValue("osc2_level")->load();
-    auto osc2Detune = parameters.getRawParameterValue("osc2_detune")->load();
-    auto osc2Pan = parameters.getRawParameterValue("osc2_pan")->load();
-
-    auto osc3Waveform = static_cast<int>(parameters.getRawParameterValue("osc3_waveform")->load());
-    auto osc3Octave = static_cast<int>(parameters.getRawParameterValue("osc3_octave")->load());
-    auto osc3Level = parameters.getRawParameterValue("osc3_level")->load();
-    auto osc3Detune = parameters.getRawParameterValue("osc3_detune")->load();
-    auto osc3Pan = parameters.getRawParameterValue("osc3_pan")->load();
-
-    auto noiseType = static_cast<int>(parameters.getRawParameterValue("noise_type")->load());
-    auto noiseLevel = parameters.getRawParameterValue("noise_level")->load();
-    auto noisePan = parameters.getRawParameterValue("noise_pan")->load();
-
-    auto attack = parameters.getRawParameterValue("envelope_attack")->load();
-    auto decay = parameters.getRawParameterValue("envelope_decay")->load();
-    auto sustain = parameters.getRawParameterValue("envelope_sustain")->load();
-    auto release = parameters.getRawParameterValue("envelope_release")->load();
-
-    auto pmIndex = parameters.getRawParameterValue("pm_index")->load();
-    auto pmCarrier = static_cast<int>(parameters.getRawParameterValue("pm_carrier")->load());
-    auto pmRatio = parameters.getRawParameterValue("pm_ratio")->load();
-
-    auto lfoWaveform = static_cast<int>(parameters.getRawParameterValue("lfo_waveform")->load());
-    auto lfoRate = parameters.getRawParameterValue("lfo_rate")->load();
-    auto lfoTarget = static_cast<int>(parameters.getRawParameterValue("lfo_target")->load());
-    auto lfoAmount = parameters.getRawParameterValue("lfo_amount")->load();
-
-    auto lfo2Waveform = static_cast<int>(parameters.getRawParameterValue("lfo2_waveform")->load());
-    auto lfo2Rate = parameters.getRawParameterValue("lfo2_rate")->load();
-    auto lfo2Target = static_cast<int>(parameters.getRawParameterValue("lfo2_target")->load());
-    auto lfo2Amount = parameters.getRawParameterValue("lfo2_amount")->load();
-
-    auto lfo3Waveform = static_cast<int>(parameters.getRawParameterValue("lfo3_waveform")->load());
-    auto lfo3Rate = parameters.getRawParameterValue("lfo3_rate")->load();
-    auto lfo3Target = static_cast<int>(parameters.getRawParameterValue("lfo3_target")->load());
-    auto lfo3Amount = parameters.getRawParameterValue("lfo3_amount")->load();
-
-    auto filterType = static_cast<int>(parameters.getRawParameterValue("filter_type")->load());
-    auto filterCutoff = parameters.getRawParameterValue("filter_cutoff")->load();
-    auto filterResonance = parameters.getRawParameterValue("filter_resonance")->load();
-    auto filterGain = parameters.getRawParameterValue("filter_gain")->load();
-
-    auto filter2Type = static_cast<int>(parameters.getRawParameterValue("filter2_type")->load());
-    auto filter2Cutoff = parameters.getRawParameterValue("filter2_cutoff")->load();
-    auto filter2Resonance = parameters.getRawParameterValue("filter2_resonance")->load();
-    auto filter2Gain = parameters.getRawParameterValue("filter2_gain")->load();
-    auto filterRouting = static_cast<int>(parameters.getRawParameterValue("filter_routing")->load());
+    snapshot.osc1Waveform = choice(Osc1Waveform);
+    snapshot.osc1Octave = choice(Osc1Octave);
+    snapshot.osc1Level = value(Osc1Level);
+    snapshot.osc1Detune = value(Osc1Detune);
+    snapshot.osc1Pan = value(Osc1Pan);
+
+    snapshot.osc2Waveform = choice(Osc2Waveform);
+    snapshot.osc2Octave = choice(Osc2Octave);
+    snapshot.osc2Level = value(Osc2Level);
+    snapshot.osc2Detune = value(Osc2Detune);
+    snapshot.osc2Pan = value(Osc2Pan);
+
+    snapshot.osc3Waveform = choice(Osc3Waveform);
+    snapshot.osc3Octave = choice(Osc3Octave);
+    snapshot.osc3Level = value(Osc3Level);
+    snapshot.osc3Detune = value(Osc3Detune);
+    snapshot.osc3Pan = value(Osc3Pan);
+
+    snapshot.osc1RenderMode = choice(Osc1RenderMode);
+    snapshot.osc2RenderMode = choice(Osc2RenderMode);
+    snapshot.osc3RenderMode = choice(Osc3RenderMode);
+
+    snapshot.osc1UnisonVoices = choice(Osc1UnisonVoices);
+    snapshot.osc1UnisonDetune = value(Osc1UnisonDetune);
+    snapshot.osc1UnisonSpread = value(Osc1UnisonSpread);
+    snapshot.osc2UnisonVoices = choice(Osc2UnisonVoices);
+    snapshot.osc2UnisonDetune = value(Osc2UnisonDetune);
+    snapshot.osc2UnisonSpread = value(Osc2UnisonSpread);
+    snapshot.osc3UnisonVoices = choice(Osc3UnisonVoices);
+    snapshot.osc3UnisonDetune = value(Osc3UnisonDetune);
+    snapshot.osc3UnisonSpread = value(Osc3UnisonSpread);
+
+    snapshot.noiseType = choice(NoiseType);
+    snapshot.noiseLevel = value(NoiseLevel);
+    snapshot.noisePan = value(NoisePan);
+
+    snapshot.attack = value(EnvelopeAttack);
+    snapshot.decay = value(EnvelopeDecay);
+    snapshot.sustain = value(EnvelopeSustain);
+    snapshot.release = value(EnvelopeRelease);
+
+    snapshot.pmIndex = value(PMIndex);
+    snapshot.pmCarrier = choice(PMCarrier);
+    snapshot.pmRatio = value(PMRatio);
+    snapshot.pmOversampling = choice(PMOversampling);
+
+    // FM operators - each operator's parameters follow FMOp1Ratio in the same order
+    static_assert(FMOp2Ratio - FMOp1Ratio == 6 && FMOp6Release == FMOp1Ratio + 6 * FreOscVoiceParameters::numFMOperators - 1,
+                  "FM operator parameters out of order");
+
+    snapshot.fmAlgorithm = choice(FMAlgorithm);
+    snapshot.fmLevel = value(FMLevel);
+    snapshot.fmFeedback = value(FMFeedback);
+
+    for (int op = 0; op < FreOscVoiceParameters::numFMOperators; ++op)
+    {
+        auto parameter = [op](int offset) { return static_cast<VoiceParameterIndex>(FMOp1Ratio + op * 6 + offset); };
+
+        auto& fmOperator = snapshot.fmOperators[op];
+        fmOperator.ratio = value(parameter(0));
+        fmOperator.level = value(parameter(1));
+        fmOperator.attack = value(parameter(2));
+        fmOperator.decay = value(parameter(3));
+        fmOperator.sustain = value(parameter(4));
+        fmOperator.release = value(parameter(5));
+    }
+
+    snapshot.lfoWaveform = choice(LfoWaveform);
+    snapshot.lfoRate = value(LfoRate);
+    snapshot.lfoTarget = choice(LfoTarget);
+    snapshot.lfoAmount = value(LfoAmount);
+
+    snapshot.lfo2Waveform = choice(Lfo2Waveform);
+    snapshot.lfo2Rate = value(Lfo2Rate);
+    snapshot.lfo2Target = choice(Lfo2Target);
+    snapshot.lfo2Amount = value(Lfo2Amount);
+
+    snapshot.lfo3Waveform = choice(Lfo3Waveform);
+    snapshot.lfo3Rate = value(Lfo3Rate);
+    snapshot.lfo3Target = choice(Lfo3Target);
+    snapshot.lfo3Amount = value(Lfo3Amount);
+
+    snapshot.filterType = choice(FilterType);
+    snapshot.filterCutoff = value(FilterCutoff);
+    snapshot.filterResonance = value(FilterResonance);
+    snapshot.filterGain = value(FilterGain);
+
+    snapshot.filter2Type = choice(Filter2Type);
+    snapshot.filter2Cutoff = value(Filter2Cutoff);
+    snapshot.filter2Resonance = value(Filter2Resonance);
+    snapshot.filter2Gain = value(Filter2Gain);
+    snapshot.filterRouting = choice(FilterRoutingMode);
+    snapshot.filterEngine = choice(FilterEngineMode);
 
     // Modulation Envelope 1 parameters
-    auto modEnv1Attack = parameters.getRawParameterValue("mod_env1_attack")->load();
-    auto modEnv1Decay = parameters.getRawParameterValue("mod_env1_decay")->load();
-    auto modEnv1Sustain = parameters.getRawParameterValue("mod_env1_sustain")->load();
-    auto modEnv1Release = parameters.getRawParameterValue("mod_env1_release")->load();
-    auto modEnv1Amount = parameters.getRawParameterValue("mod_env1_amount")->load();
-    auto modEnv1Target = static_cast<int>(parameters.getRawParameterValue("mod_env1_target")->load());
-    auto modEnv1Mode = static_cast<int>(parameters.getRawParameterValue("mod_env1_mode")->load());
-    auto modEnv1Rate = parameters.getRawParameterValue("mod_env1_rate")->load();
+    snapshot.modEnv1Attack = value(ModEnv1Attack);
+    snapshot.modEnv1Decay = value(ModEnv1Decay);
+    snapshot.modEnv1Sustain = value(ModEnv1Sustain);
+    snapshot.modEnv1Release = value(ModEnv1Release);
+    snapshot.modEnv1Amount = value(ModEnv1Amount);
+    snapshot.modEnv1Target = choice(ModEnv1Target);
+    snapshot.modEnv1Mode = choice(ModEnv1Mode);
+    snapshot.modEnv1Rate = value(ModEnv1Rate);
 
     // Modulation Envelope 2 parameters
-    auto modEnv2Attack = parameters.getRawParameterValue("mod_env2_attack")->load();
-    auto modEnv2Decay = parameters.getRawParameterValue("mod_env2_decay")->load();
-    auto modEnv2Sustain = parameters.getRawParameterValue("mod_env2_sustain")->load();
-    auto modEnv2Release = parameters.getRawParameterValue("mod_env2_release")->load();
-    auto modEnv2Amount = parameters.getRawParameterValue("mod_env2_amount")->load();
-    auto modEnv2Target = static_cast<int>(parameters.getRawParameterValue("mod_env2_target")->load());
-    auto modEnv2Mode = static_cast<int>(parameters.getRawParameterValue("mod_env2_mode")->load());
-    auto modEnv2Rate = parameters.getRawParameterValue("mod_env2_rate")->load();
-
-    // Update all voices with current parameters
+    snapshot.modEnv2Attack = value(ModEnv2Attack);
+    snapshot.modEnv2Decay = value(ModEnv2Decay);
+    snapshot.modEnv2Sustain = value(ModEnv2Sustain);
+    snapshot.modEnv2Release = value(ModEnv2Release);
+    snapshot.modEnv2Amount = value(ModEnv2Amount);
+    snapshot.modEnv2Target = choice(ModEnv2Target);
+    snapshot.modEnv2Mode = choice(ModEnv2Mode);
+    snapshot.modEnv2Rate = value(ModEnv2Rate);
+
+    // Modulation quality (choice index -> samples per control-rate update)
+    static constexpr int controlRateDivisors[] = { 1, 8, 16, 32 };
+    auto controlRateIndex = juce::jlimit(0, 3, choice(ModControlRate));
+    snapshot.controlRateDivisor = controlRateDivisors[controlRateIndex];
+
+    // Voice retirement threshold (dBFS -> gain)
+    snapshot.retireThreshold = juce::Decibels::decibelsToGain(value(VoiceRetireThreshold), -200.0f);
+
+    snapshot.trigPrecision = choice(TrigPrecision);
+
+    // Compile LFO / mod envelope targets into the routing table once for all voices
+    const auto routingGroups = (1u << FreOscVoiceParameters::LFOGroup)
+                             | (1u << FreOscVoiceParameters::ModEnv1Group)
+                             | (1u << FreOscVoiceParameters::ModEnv2Group);
+
+    if ((changedGroups & routingGroups) != 0)
+    {
+        const int lfoTargets[] = { snapshot.lfoTarget, snapshot.lfo2Target, snapshot.lfo3Target };
+        const float lfoAmounts[] = { snapshot.lfoAmount, snapshot.lfo2Amount, snapshot.lfo3Amount };
+        const int modEnvTargets[] = { snapshot.modEnv1Target, snapshot.modEnv2Target };
+        const float modEnvAmounts[] = { snapshot.modEnv1Amount, snapshot.modEnv2Amount };
+        snapshot.routing.compile(lfoTargets, lfoAmounts, modEnvTargets, modEnvAmounts);
+    }
+    else
+    {
+        snapshot.routing = published.routing;
+    }
+
+    // Design both filters once for all voices instead of once per voice
+    const auto filterGroups = (1u << FreOscVoiceParameters::FilterGroup)
+                            | (1u << FreOscVoiceParameters::Filter2Group)
+                            | (1u << FreOscVoiceParameters::GlobalGroup);
+
+    if ((changedGroups & filterGroups) != 0)
+    {
+        auto design = [&snapshot](FreOscFilter& designer, int type, float cutoff, float resonance, float gain)
+        {
+            designer.setEngine(static_cast<FreOscFilter::FilterEngine>(juce::jlimit(0, 1, snapshot.filterEngine)));
+            designer.setFilterType(static_cast<FreOscFilter::FilterType>(type));
+            designer.setCutoffFrequency(cutoff);
+            designer.setResonance(resonance);
+            designer.setGain(gain);
+            return designer.getCoefficients();
+        };
+
+        snapshot.filterCoefficients = design(filterDesigners[0], snapshot.filterType, snapshot.filterCutoff,
+                                             snapshot.filterResonance, snapshot.filterGain);
+        snapshot.filter2Coefficients = design(filterDesigners[1], snapshot.filter2Type, snapshot.filter2Cutoff,
+                                              snapshot.filter2Resonance, snapshot.filter2Gain);
+    }
+    else
+    {
+        snapshot.filterCoefficients = published.filterCoefficients;
+        snapshot.filter2Coefficients = published.filter2Coefficients;
+    }
+
+    // Bump the version of every group that changed so voices only reconfigure those
+    for (int group = 0; group < FreOscVoiceParameters::NumGroups; ++group)
+    {
+        const bool groupChanged = (changedGroups & (1u << group)) != 0;
+        snapshot.groupVersions[group] = published.groupVersions[group] + (groupChanged ? 1u : 0u);
+    }
+
+    publishedSnapshotIndex = 1 - publishedSnapshotIndex;
+
+    // Publish the snapshot to all voices
     for (int i = 0; i < synthesiser.getNumVoices(); ++i)
     {
         if (auto voice = dynamic_cast<FreOscVoice*>(synthesiser.getVoice(i)))
-        {
-            voice->updateOscillatorParameters(
-                osc1Waveform, osc1Octave, osc1Level, osc1Detune, osc1Pan,
-                osc2Waveform, osc2Octave, osc2Level, osc2Detune, osc2Pan,
-                osc3Waveform, osc3Octave, osc3Level, osc3Detune, osc3Pan
-            );
-
-            voice->updateNoiseParameters(noiseType, noiseLevel, noisePan);
-            voice->updateEnvelopeParameters(attack, decay, sustain, release);
-            voice->updatePMParameters(pmIndex, pmCarrier, pmRatio);
-            voice->updateLFOParameters(lfoWaveform, lfoRate, lfoTarget, lfoAmount);
-            voice->updateLFO2Parameters(lfo2Waveform, lfo2Rate, lfo2Target, lfo2Amount);
-            voice->updateLFO3Parameters(lfo3Waveform, lfo3Rate, lfo3Target, lfo3Amount);
-            voice->updateFilterParameters(filterType, filterCutoff, filterResonance, filterGain);
-            voice->updateFilter2Parameters(filter2Type, filter2Cutoff, filter2Resonance, filter2Gain);
-            voice->updateFilterRouting(filterRouting);
-            voice->updateModEnv1Parameters(modEnv1Attack, modEnv1Decay, modEnv1Sustain, modEnv1Release, modEnv1Amount, modEnv1Target, modEnv1Mode, modEnv1Rate);
-            voice->updateModEnv2Parameters(modEnv2Attack, modEnv2Decay, modEnv2Sustain, modEnv2Release, modEnv2Amount, modEnv2Target, modEnv2Mode, modEnv2Rate);
-        }
+            voice->setParameters(snapshot);
     }
+
+    voiceBank.setParameters(snapshot);
 }
 
 void FreOscProcessor::updateEffectsParameters()
 {
+    // Only touch the effects whose parameters moved since the last block
+    const auto changedEffects = pollChangedGroups(effectParameterHandles, NumEffectParameters, effectParametersNeedFullUpdate);
+    effectParametersNeedFullUpdate = false;
+
+    if (changedEffects == 0)
+        return;
+
+    auto value = [this](EffectParameterIndex index) { return effectParameterHandles[index].lastValue; };
+    auto effectChanged = [changedEffects](EffectGroup group) { return (changedEffects & (1u << group)) != 0; };
+
     // Update clean compressor parameters (index 0)
-    auto& compressor = effectsChain.get<0>();
-    compressor.setThreshold(parameters.getRawParameterValue("comp_threshold")->load());
-    compressor.setRatio(parameters.getRawParameterValue("comp_ratio")->load());
-    compressor.setAttack(parameters.getRawParameterValue("comp_attack")->load());
-    compressor.setRelease(parameters.getRawParameterValue("comp_release")->load());
-    compressor.setMakeupGain(parameters.getRawParameterValue("comp_makeup")->load());
-    compressor.setMix(parameters.getRawParameterValue("comp_mix")->load());
-    
+    if (effectChanged(CompressorGroup))
+    {
+        auto& compressor = effectsChain.get<0>();
+        compressor.setThreshold(value(CompThreshold));
+        compressor.setRatio(value(CompRatio));
+        compressor.setAttack(value(CompAttack));
+        compressor.setRelease(value(CompRelease));
+        compressor.setMakeupGain(value(CompMakeup));
+        compressor.setMix(value(CompMix));
+    }
+
     // Update clean limiter parameters (index 1)
-    auto& limiter = effectsChain.get<1>();
-    limiter.setThreshold(parameters.getRawParameterValue("limiter_threshold")->load());
-    limiter.setRelease(parameters.getRawParameterValue("limiter_release")->load());
-    limiter.setCeiling(parameters.getRawParameterValue("limiter_ceiling")->load());
-    limiter.setSaturation(parameters.getRawParameterValue("limiter_saturation")->load());
+    if (effectChanged(LimiterGroup))
+    {
+        auto& limiter = effectsChain.get<1>();
+        limiter.setThreshold(value(LimiterThreshold));
+        limiter.setRelease(value(LimiterRelease));
+        limiter.setCeiling(value(LimiterCeiling));
+        limiter.setSaturation(value(LimiterSaturation));
+    }
 
     // Update plate reverb parameters (now at index 2)
-    auto& plateReverb = effectsChain.get<2>();
-    plateReverb.setPreDelay(parameters.getRawParameterValue("plate_predelay")->load());
-    plateReverb.setSize(parameters.getRawParameterValue("plate_size")->load());
-    plateReverb.setDamping(parameters.getRawParameterValue("plate_damping")->load());
-    plateReverb.setDiffusion(parameters.getRawParameterValue("plate_diffusion")->load());
-    plateReverb.setWetLevel(parameters.getRawParameterValue("plate_wet_level")->load());
-    plateReverb.setStereoWidth(parameters.getRawParameterValue("plate_width")->load());
+    if (effectChanged(ReverbGroup))
+    {
+        auto& plateReverb = effectsChain.get<2>();
+        plateReverb.setPreDelay(value(PlatePreDelay));
+        plateReverb.setSize(value(PlateSize));
+        plateReverb.setDamping(value(PlateDamping));
+        plateReverb.setDiffusion(value(PlateDiffusion));
+        plateReverb.setWetLevel(value(PlateWetLevel));
+        plateReverb.setStereoWidth(value(PlateWidth));
+    }
 
     // Update tape delay parameters (now at index 3)
-    auto& tapeDelay = effectsChain.get<3>();
-    tapeDelay.setTime(parameters.getRawParameterValue("tape_time")->load());
-    tapeDelay.setFeedback(parameters.getRawParameterValue("tape_feedback")->load());
-    tapeDelay.setTone(parameters.getRawParameterValue("tape_tone")->load());
-    tapeDelay.setFlutter(parameters.getRawParameterValue("tape_flutter")->load());
-    tapeDelay.setWetLevel(parameters.getRawParameterValue("tape_wet_level")->load());
-    tapeDelay.setStereoWidth(parameters.getRawParameterValue("tape_width")->load());
+    if (effectChanged(DelayGroup))
+    {
+        auto& tapeDelay = effectsChain.get<3>();
+        tapeDelay.setTime(value(TapeTime));
+        tapeDelay.setFeedback(value(TapeFeedback));
+        tapeDelay.setTone(value(TapeTone));
+        tapeDelay.setFlutter(value(TapeFlutter));
+        tapeDelay.setWetLevel(value(TapeWetLevel));
+        tapeDelay.setStereoWidth(value(TapeWidth));
+    }
 
     // Update wavefolder parameters (now at index 4)
-    auto& wavefolder = effectsChain.get<4>();
-    wavefolder.setDrive(parameters.getRawParameterValue("wavefolder_drive")->load());
-    wavefolder.setThreshold(parameters.getRawParameterValue("wavefolder_threshold")->load());
-    wavefolder.setSymmetry(parameters.getRawParameterValue("wavefolder_symmetry")->load());
-    wavefolder.setMix(parameters.getRawParameterValue("wavefolder_mix")->load());
-    wavefolder.setOutputLevel(parameters.getRawParameterValue("wavefolder_output")->load());
+    if (effectChanged(WavefolderGroup))
+    {
+        auto& wavefolder = effectsChain.get<4>();
+        wavefolder.setDrive(value(WavefolderDrive));
+        wavefolder.setThreshold(value(WavefolderThreshold));
+        wavefolder.setSymmetry(value(WavefolderSymmetry));
+        wavefolder.setMix(value(WavefolderMix));
+        wavefolder.setOutputLevel(value(WavefolderOutput));
+    }
 }
 
 //==============================================================================
@@ -564,17 +937,17 @@ void FreOscProcessor::processEffectsWithRouting(juce::dsp::ProcessContextReplaci
     {
         case 0: // Wavefolder to Reverb to Delay
         {
-            wavefolder.process(context);
-            plateReverb.process(context);
-            tapeDelay.process(context);
+            processEffect(FreOscProfilingStats::Wavefolder, wavefolder, context);
+            processEffect(FreOscProfilingStats::Reverb, plateReverb, context);
+            processEffect(FreOscProfilingStats::Delay, tapeDelay, context);
             break;
         }
         
         case 1: // Wavefolder to Delay to Reverb
         {
-            wavefolder.process(context);
-            tapeDelay.process(context);
-            plateReverb.process(context);
+            processEffect(FreOscProfilingStats::Wavefolder, wavefolder, context);
+            processEffect(FreOscProfilingStats::Delay, tapeDelay, context);
+            processEffect(FreOscProfilingStats::Reverb, plateReverb, context);
             break;
         }
         
@@ -602,13 +975,13 @@ void FreOscProcessor::processEffectsWithRouting(juce::dsp::ProcessContextReplaci
             // Process wavefolder on one path
             auto wavefolderBlock = juce::dsp::AudioBlock<float>(wavefolderBuffer);
             juce::dsp::ProcessContextReplacing<float> wavefolderContext(wavefolderBlock);
-            wavefolder.process(wavefolderContext);
+            processEffect(FreOscProfilingStats::Wavefolder, wavefolder, wavefolderContext);
             
             // Process reverb+delay on the other path
             auto reverbDelayBlock = juce::dsp::AudioBlock<float>(reverbDelayBuffer);
             juce::dsp::ProcessContextReplacing<float> reverbDelayContext(reverbDelayBlock);
-            plateReverb.process(reverbDelayContext);
-            tapeDelay.process(reverbDelayContext);
+            processEffect(FreOscProfilingStats::Reverb, plateReverb, reverbDelayContext);
+            processEffect(FreOscProfilingStats::Delay, tapeDelay, reverbDelayContext);
             
             // Mix the parallel outputs
             auto& outputBlock = context.getOutputBlock();
@@ -628,9 +1001,9 @@ void FreOscProcessor::processEffectsWithRouting(juce::dsp::ProcessContextReplaci
         
         default:
             // Fallback to first wavefolder routing
-            wavefolder.process(context);
-            plateReverb.process(context);
-            tapeDelay.process(context);
+            processEffect(FreOscProfilingStats::Wavefolder, wavefolder, context);
+            processEffect(FreOscProfilingStats::Reverb, plateReverb, context);
+            processEffect(FreOscProfilingStats::Delay, tapeDelay, context);
             break;
     }
 }
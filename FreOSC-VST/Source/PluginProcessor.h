@@ -3,6 +3,9 @@
 #include <juce_audio_processors/juce_audio_processors.h>
 #include <juce_dsp/juce_dsp.h>
 #include "DSP/FreOscVoice.h"
+#include "DSP/FreOscVoiceParameters.h"
+#include "DSP/FreOscVoiceBank.h"
+#include "DSP/FreOscSynthesiser.h"
 #include "DSP/FreOscSound.h"
 #include "DSP/FreOscFilter.h"
 #include "DSP/FreOscCompressor.h"
@@ -11,6 +14,7 @@
 #include "DSP/FreOscTapeDelay.h"
 #include "DSP/FreOscWavefolder.h"
 #include "DSP/FreOscLFO.h"
+#include "DSP/FreOscAdditive.h"
 #include "Parameters/FreOscParameters.h"
 #include "Presets/JsonPresetManager.h"
 
@@ -70,6 +74,9 @@ public:
     juce::AudioProcessorValueTreeState& getValueTreeState() { return parameters; }
     JsonPresetManager& getPresets() { return presets; }
 
+    // CPU statistics, filled in when built with FREOSC_ENABLE_PROFILING
+    FreOscProfilingStats& getProfilingStats() { return profilingStats; }
+
     // Preset loading interface
     void loadPreset(int presetIndex);
     void loadPreset(const juce::String& presetName);
@@ -92,7 +99,99 @@ private:
     juce::AudioProcessorValueTreeState parameters;
 
     // Voice management
-    juce::Synthesiser synthesiser;
+    FreOscSynthesiser synthesiser;
+
+    // Double-buffered voice parameter snapshot (one is published, the other is being filled)
+    FreOscVoiceParameters voiceParameterSnapshots[2];
+    int publishedSnapshotIndex = 0;
+
+    // SIMD voice bank engine, used instead of synthesiser when selected and the
+    // patch has no modulation. The engine is chosen per note: each note-on goes
+    // to the engine selected when it arrives, and the note plays out there even
+    // if the patch changes, so both engines render every block.
+    FreOscVoiceBank voiceBank;
+    FreOscBankSynthesiser bankSynthesiser { voiceBank };
+    juce::MidiBuffer classicMidi, bankMidi;     // This block's MIDI, split by engine
+    bool notesOnVoiceBank[16][128] = {};        // Engine each channel/note last started on
+
+    //==============================================================================
+    // Parameter value handles, resolved once at construction instead of looking
+    // up parameter IDs every block. The last propagated value of each parameter
+    // is kept so only groups containing a changed parameter are pushed on.
+    struct CachedParameter
+    {
+        std::atomic<float>* value = nullptr;
+        float lastValue = 0.0f;
+        int group = 0;
+    };
+
+    enum VoiceParameterIndex
+    {
+        Osc1Waveform = 0, Osc1Octave, Osc1Level, Osc1Detune, Osc1Pan,
+        Osc2Waveform, Osc2Octave, Osc2Level, Osc2Detune, Osc2Pan,
+        Osc3Waveform, Osc3Octave, Osc3Level, Osc3Detune, Osc3Pan,
+        NoiseType, NoiseLevel, NoisePan,
+        EnvelopeAttack, EnvelopeDecay, EnvelopeSustain, EnvelopeRelease,
+        PMIndex, PMCarrier, PMRatio,
+        LfoWaveform, LfoRate, LfoTarget, LfoAmount,
+        Lfo2Waveform, Lfo2Rate, Lfo2Target, Lfo2Amount,
+        Lfo3Waveform, Lfo3Rate, Lfo3Target, Lfo3Amount,
+        FilterType, FilterCutoff, FilterResonance, FilterGain,
+        Filter2Type, Filter2Cutoff, Filter2Resonance, Filter2Gain,
+        ModEnv1Attack, ModEnv1Decay, ModEnv1Sustain, ModEnv1Release, ModEnv1Amount, ModEnv1Target, ModEnv1Mode, ModEnv1Rate,
+        ModEnv2Attack, ModEnv2Decay, ModEnv2Sustain, ModEnv2Release, ModEnv2Amount, ModEnv2Target, ModEnv2Mode, ModEnv2Rate,
+        FilterRoutingMode, ModControlRate, VoiceRetireThreshold,
+        Osc1RenderMode, Osc2RenderMode, Osc3RenderMode,
+        TrigPrecision,
+        Osc1UnisonVoices, Osc1UnisonDetune, Osc1UnisonSpread,
+        Osc2UnisonVoices, Osc2UnisonDetune, Osc2UnisonSpread,
+        Osc3UnisonVoices, Osc3UnisonDetune, Osc3UnisonSpread,
+        PMOversampling,
+        FMAlgorithm, FMLevel, FMFeedback,
+        FMOp1Ratio, FMOp1Level, FMOp1Attack, FMOp1Decay, FMOp1Sustain, FMOp1Release,
+        FMOp2Ratio, FMOp2Level, FMOp2Attack, FMOp2Decay, FMOp2Sustain, FMOp2Release,
+        FMOp3Ratio, FMOp3Level, FMOp3Attack, FMOp3Decay, FMOp3Sustain, FMOp3Release,
+        FMOp4Ratio, FMOp4Level, FMOp4Attack, FMOp4Decay, FMOp4Sustain, FMOp4Release,
+        FMOp5Ratio, FMOp5Level, FMOp5Attack, FMOp5Decay, FMOp5Sustain, FMOp5Release,
+        FMOp6Ratio, FMOp6Level, FMOp6Attack, FMOp6Decay, FMOp6Sustain, FMOp6Release,
+        FilterEngineMode,
+        NumVoiceParameters
+    };
+
+    enum EffectParameterIndex
+    {
+        CompThreshold = 0, CompRatio, CompAttack, CompRelease, CompMakeup, CompMix,
+        LimiterThreshold, LimiterRelease, LimiterCeiling, LimiterSaturation,
+        PlatePreDelay, PlateSize, PlateDamping, PlateDiffusion, PlateWetLevel, PlateWidth,
+        TapeTime, TapeFeedback, TapeTone, TapeFlutter, TapeWetLevel, TapeWidth,
+        WavefolderDrive, WavefolderThreshold, WavefolderSymmetry, WavefolderMix, WavefolderOutput,
+        NumEffectParameters
+    };
+
+    // Effect groups match the effects chain indices
+    enum EffectGroup
+    {
+        CompressorGroup = 0,
+        LimiterGroup,
+        ReverbGroup,
+        DelayGroup,
+        WavefolderGroup
+    };
+
+    CachedParameter voiceParameterHandles[NumVoiceParameters];
+    CachedParameter effectParameterHandles[NumEffectParameters];
+    std::atomic<float>* effectsRoutingParameter = nullptr;
+    std::atomic<float>* masterVolumeParameter = nullptr;
+    std::atomic<float>* voiceEngineParameter = nullptr;
+    std::atomic<float>* renderThreadsParameter = nullptr;
+    std::atomic<float>* renderWaitModeParameter = nullptr;
+    std::atomic<float>* polyphonyParameter = nullptr;
+    std::atomic<float>* additivePartialsParameter = nullptr;
+    std::atomic<float>* additiveBrightnessParameter = nullptr;
+
+    // Set until the first update has pushed every parameter
+    bool voiceParametersNeedFullUpdate = true;
+    bool effectParametersNeedFullUpdate = true;
 
     // Effects chain using custom DSP (filter now per-voice)
     juce::dsp::ProcessorChain<
@@ -106,6 +205,15 @@ private:
     // Preset management
     JsonPresetManager presets;
 
+    // Additive oscillator spectra, rebuilt on the message thread
+    FreOscAdditiveProfiles additiveProfiles;
+
+    // Prewarped filter cutoff tables, rebuilt when the sample rate changes
+    FreOscFilterTables filterTables;
+
+    // Design filter 1 and 2 coefficients once per change for every voice's filters
+    FreOscFilter filterDesigners[2];
+
     // Audio processing state
     double currentSampleRate = 44100.0;
     int currentBlockSize = 512;
@@ -116,15 +224,33 @@ private:
     // Master volume smoothing to prevent pops
     juce::LinearSmoothedValue<float> masterVolumeSmooth;
 
+    // CPU instrumentation (stage timers compile away unless FREOSC_ENABLE_PROFILING)
+    FreOscProfilingStats profilingStats;
+
     //==============================================================================
     // Parameter update methods
     void updateVoiceParameters();
     void updateEffectsParameters();
 
     // Helper methods
+    void initializeParameterHandles();
+    static juce::uint32 pollChangedGroups(CachedParameter* handles, int numHandles, bool forceAll);
     void initializeSynthesiser();
+    void allocateVoicePool();
+    void splitMidiByEngine(const juce::MidiBuffer& midiMessages, bool useVoiceBank);
     void setupEffectsChain();
     void processEffectsWithRouting(juce::dsp::ProcessContextReplacing<float>& context, int routingMode);
+
+    template <typename Effect>
+    void processEffect(FreOscProfilingStats::Stage stage, Effect& effect, juce::dsp::ProcessContextReplacing<float>& context)
+    {
+       #if FREOSC_ENABLE_PROFILING
+        const FreOscProfilingStats::ScopedTimer timer(&profilingStats, stage);
+       #else
+        juce::ignoreUnused(stage);
+       #endif
+        effect.process(context);
+    }
     
     // Master volume conversion: 0.0 = silence, 0.75 = 0dB (unity), 1.0 = +24dB
     float normalizedToMasterGain(float normalized) const;
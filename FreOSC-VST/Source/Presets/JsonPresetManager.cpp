@@ -396,6 +396,11 @@ juce::var JsonPresetManager::createSimplePresetJson(const juce::String& name, co
         "osc1_waveform", "osc1_octave", "osc1_level", "osc1_detune", "osc1_pan",
         "osc2_waveform", "osc2_octave", "osc2_level", "osc2_detune", "osc2_pan", 
         "osc3_waveform", "osc3_octave", "osc3_level", "osc3_detune", "osc3_pan",
+        "osc1_render_mode", "osc2_render_mode", "osc3_render_mode",
+        "osc1_unison_voices", "osc1_unison_detune", "osc1_unison_spread",
+        "osc2_unison_voices", "osc2_unison_detune", "osc2_unison_spread",
+        "osc3_unison_voices", "osc3_unison_detune", "osc3_unison_spread",
+        "additive_partials", "additive_brightness",
         
         // Noise
         "noise_type", "noise_level", "noise_pan",
@@ -404,7 +409,7 @@ juce::var JsonPresetManager::createSimplePresetJson(const juce::String& name, co
         "envelope_attack", "envelope_decay", "envelope_sustain", "envelope_release",
         
         // Filters
-        "filter_routing", "filter_type", "filter_cutoff", "filter_resonance", "filter_gain",
+        "filter_routing", "filter_engine", "filter_type", "filter_cutoff", "filter_resonance", "filter_gain",
         "filter2_type", "filter2_cutoff", "filter2_resonance", "filter2_gain",
         
         // LFO
@@ -417,9 +422,22 @@ juce::var JsonPresetManager::createSimplePresetJson(const juce::String& name, co
         "mod_env1_amount", "mod_env1_target", "mod_env1_mode", "mod_env1_rate",
         "mod_env2_attack", "mod_env2_decay", "mod_env2_sustain", "mod_env2_release", 
         "mod_env2_amount", "mod_env2_target", "mod_env2_mode", "mod_env2_rate",
+        "mod_control_rate", "voice_retire_threshold", "trig_precision",
+
+        // Voices
+        "polyphony",
         
         // PM Synthesis
-        "pm_index", "pm_ratio", "pm_carrier",
+        "pm_index", "pm_ratio", "pm_carrier", "pm_oversampling",
+
+        // FM operator engine
+        "fm_algorithm", "fm_level", "fm_feedback",
+        "fm_op1_ratio", "fm_op1_level", "fm_op1_attack", "fm_op1_decay", "fm_op1_sustain", "fm_op1_release",
+        "fm_op2_ratio", "fm_op2_level", "fm_op2_attack", "fm_op2_decay", "fm_op2_sustain", "fm_op2_release",
+        "fm_op3_ratio", "fm_op3_level", "fm_op3_attack", "fm_op3_decay", "fm_op3_sustain", "fm_op3_release",
+        "fm_op4_ratio", "fm_op4_level", "fm_op4_attack", "fm_op4_decay", "fm_op4_sustain", "fm_op4_release",
+        "fm_op5_ratio", "fm_op5_level", "fm_op5_attack", "fm_op5_decay", "fm_op5_sustain", "fm_op5_release",
+        "fm_op6_ratio", "fm_op6_level", "fm_op6_attack", "fm_op6_decay", "fm_op6_sustain", "fm_op6_release",
         
         
         
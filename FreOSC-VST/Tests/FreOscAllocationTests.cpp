@@ -0,0 +1,199 @@
+#include "FreOscOscillator.h"
+#include "FreOscLFO.h"
+#include "FreOscAdditive.h"
+#include <atomic>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <new>
+
+//==============================================================================
+/**
+    FreOSC allocation tests
+
+    Replaces the global allocation functions with counting versions and checks
+    that switching waveforms while rendering never touches the heap. Objects
+    are created and prepared before counting starts; only the audio-thread
+    calls (setWaveform, renderBlock, getNextSample) run while it is armed.
+*/
+namespace
+{
+    std::atomic<bool> countingAllocations { false };
+    std::atomic<long> allocationCount { 0 };
+
+    void* allocate(std::size_t size)
+    {
+        if (countingAllocations.load(std::memory_order_relaxed))
+            allocationCount.fetch_add(1, std::memory_order_relaxed);
+
+        return std::malloc(size == 0 ? 1 : size);
+    }
+
+    // Over-allocates and keeps the malloc pointer just before the aligned block
+    void* allocateAligned(std::size_t size, std::align_val_t alignment)
+    {
+        const auto align = juce::jmax(static_cast<std::size_t>(alignment), sizeof(void*));
+        auto* raw = static_cast<char*>(allocate(size + align + sizeof(void*)));
+        if (raw == nullptr)
+            return nullptr;
+
+        const auto address = reinterpret_cast<std::uintptr_t>(raw + sizeof(void*));
+        auto* aligned = reinterpret_cast<char*>((address + align - 1) & ~(static_cast<std::uintptr_t>(align) - 1));
+        reinterpret_cast<void**>(aligned)[-1] = raw;
+        return aligned;
+    }
+
+    void deallocateAligned(void* pointer)
+    {
+        if (pointer != nullptr)
+            std::free(reinterpret_cast<void**>(pointer)[-1]);
+    }
+
+    void* allocateOrThrow(std::size_t size)
+    {
+        if (auto* pointer = allocate(size))
+            return pointer;
+
+        throw std::bad_alloc();
+    }
+
+    void* allocateAlignedOrThrow(std::size_t size, std::align_val_t alignment)
+    {
+        if (auto* pointer = allocateAligned(size, alignment))
+            return pointer;
+
+        throw std::bad_alloc();
+    }
+}
+
+void* operator new (std::size_t size)                                              { return allocateOrThrow(size); }
+void* operator new[] (std::size_t size)                                            { return allocateOrThrow(size); }
+void* operator new (std::size_t size, const std::nothrow_t&) noexcept              { return allocate(size); }
+void* operator new[] (std::size_t size, const std::nothrow_t&) noexcept            { return allocate(size); }
+void* operator new (std::size_t size, std::align_val_t alignment)                  { return allocateAlignedOrThrow(size, alignment); }
+void* operator new[] (std::size_t size, std::align_val_t alignment)                { return allocateAlignedOrThrow(size, alignment); }
+void* operator new (std::size_t size, std::align_val_t alignment, const std::nothrow_t&) noexcept   { return allocateAligned(size, alignment); }
+void* operator new[] (std::size_t size, std::align_val_t alignment, const std::nothrow_t&) noexcept { return allocateAligned(size, alignment); }
+
+void operator delete (void* pointer) noexcept                                      { std::free(pointer); }
+void operator delete[] (void* pointer) noexcept                                    { std::free(pointer); }
+void operator delete (void* pointer, std::size_t) noexcept                         { std::free(pointer); }
+void operator delete[] (void* pointer, std::size_t) noexcept                       { std::free(pointer); }
+void operator delete (void* pointer, const std::nothrow_t&) noexcept               { std::free(pointer); }
+void operator delete[] (void* pointer, const std::nothrow_t&) noexcept             { std::free(pointer); }
+void operator delete (void* pointer, std::align_val_t) noexcept                    { deallocateAligned(pointer); }
+void operator delete[] (void* pointer, std::align_val_t) noexcept                  { deallocateAligned(pointer); }
+void operator delete (void* pointer, std::size_t, std::align_val_t) noexcept       { deallocateAligned(pointer); }
+void operator delete[] (void* pointer, std::size_t, std::align_val_t) noexcept     { deallocateAligned(pointer); }
+void operator delete (void* pointer, std::align_val_t, const std::nothrow_t&) noexcept   { deallocateAligned(pointer); }
+void operator delete[] (void* pointer, std::align_val_t, const std::nothrow_t&) noexcept { deallocateAligned(pointer); }
+
+//==============================================================================
+namespace
+{
+    constexpr double sampleRate = 48000.0;
+    constexpr int blockSize = 64;
+    constexpr int numSweeps = 100;
+
+    // Runs body with allocation counting armed and reports how many allocations it made
+    template <typename Body>
+    bool expectNoAllocations(const char* name, Body&& body)
+    {
+        allocationCount.store(0);
+        countingAllocations.store(true);
+        body();
+        countingAllocations.store(false);
+
+        const long count = allocationCount.load();
+        std::printf("%s %s (%ld allocations)\n", count == 0 ? "PASS" : "FAIL", name, count);
+        return count == 0;
+    }
+
+    // Every waveform in every render mode, through the mono, stereo and pitch-modulated paths
+    bool testOscillatorWaveformSweep(const char* name, int unisonVoices)
+    {
+        const FreOscOscillator::Waveform waveforms[] = { FreOscOscillator::Waveform::Sine, FreOscOscillator::Waveform::Square,
+                                                         FreOscOscillator::Waveform::Sawtooth, FreOscOscillator::Waveform::Triangle };
+        const FreOscOscillator::RenderMode renderModes[] = { FreOscOscillator::RenderMode::Raw, FreOscOscillator::RenderMode::PolyBLEP,
+                                                             FreOscOscillator::RenderMode::Wavetable, FreOscOscillator::RenderMode::Additive };
+
+        FreOscAdditiveProfiles additiveProfiles;
+
+        FreOscOscillator oscillator;
+        oscillator.prepare({ sampleRate, static_cast<juce::uint32>(blockSize), 1 });
+        oscillator.setAdditiveProfiles(&additiveProfiles);
+        oscillator.setUnison(unisonVoices, 20.0f, 0.5f);
+        oscillator.setFrequency(440.0f);
+        oscillator.setLevel(0.8f);
+
+        float block[blockSize] = {};
+        float side[blockSize] = {};
+        float pitchModulation[blockSize] = {};
+
+        return expectNoAllocations(name, [&]
+        {
+            for (int sweep = 0; sweep < numSweeps; ++sweep)
+            {
+                for (auto renderMode : renderModes)
+                {
+                    oscillator.setRenderMode(renderMode);
+
+                    for (auto waveform : waveforms)
+                    {
+                        oscillator.setWaveform(waveform);
+                        oscillator.renderBlock(block, blockSize);
+                        oscillator.renderBlock(block, blockSize, nullptr, pitchModulation);
+                        oscillator.renderStereoBlock(block, side, blockSize);
+                        oscillator.processSample();
+                    }
+                }
+            }
+        });
+    }
+
+    bool testLFOWaveformSweep()
+    {
+        const FreOscLFO::Waveform waveforms[] = { FreOscLFO::Waveform::Sine, FreOscLFO::Waveform::Triangle,
+                                                  FreOscLFO::Waveform::Sawtooth, FreOscLFO::Waveform::Square,
+                                                  FreOscLFO::Waveform::Random };
+
+        FreOscLFO lfo;
+        lfo.prepare(sampleRate);
+        lfo.setAmount(1.0f);
+        lfo.setTarget(FreOscLFO::Target::Filter);
+
+        return expectNoAllocations("FreOscLFO waveform sweep", [&]
+        {
+            float sum = 0.0f;
+
+            for (int sweep = 0; sweep < numSweeps; ++sweep)
+            {
+                for (auto waveform : waveforms)
+                {
+                    lfo.setWaveform(waveform);
+
+                    for (int sample = 0; sample < blockSize; ++sample)
+                        sum += lfo.getNextSample(waveform, 5.0f, FreOscLFO::Target::Filter);
+
+                    sum += lfo.getNextSample(waveform, 5.0f, FreOscLFO::Target::Filter, 16);
+                }
+            }
+
+            juce::ignoreUnused(sum);
+        });
+    }
+}
+
+//==============================================================================
+int main()
+{
+    // The additive profiles run a message thread timer
+    juce::ScopedJuceInitialiser_GUI juceInitialiser;
+
+    bool passed = true;
+    passed = testOscillatorWaveformSweep("FreOscOscillator waveform sweep", 1) && passed;
+    passed = testOscillatorWaveformSweep("FreOscOscillator unison waveform sweep", FreOscOscillator::maxUnisonVoices) && passed;
+    passed = testLFOWaveformSweep() && passed;
+
+    return passed ? 0 : 1;
+}
@@ -0,0 +1,90 @@
+#include "FreOscVoice.h"
+#include "FreOscSound.h"
+#include <cstdio>
+
+//==============================================================================
+/**
+    FreOSC voice retirement tests
+
+    Plays a quiet note with a long release and checks that the voice frees
+    itself within the retirement hold time once its output has fallen below
+    the retire threshold, well before the release envelope would reach zero.
+*/
+namespace
+{
+    constexpr double sampleRate = 48000.0;
+    constexpr int blockSize = 32;
+
+    bool testReleasedVoiceRetires()
+    {
+        // A single sine at a low sustain level releasing over 2 seconds (release
+        // times are from full scale). The envelope floor of 0.001 would keep this
+        // tail above the -96 dBFS threshold until the envelope went idle.
+        FreOscVoiceParameters parameters;
+        parameters.osc1Level = 0.5f;
+        parameters.osc1Pan = 0.0f;
+        parameters.osc2Level = 0.0f;
+        parameters.osc3Level = 0.0f;
+        parameters.attack = 0.001f;
+        parameters.decay = 0.001f;
+        parameters.sustain = 0.002f;
+        parameters.release = 1000.0f;
+        parameters.filterCutoff = 1.0f;
+
+        const int releaseSamples = static_cast<int>(parameters.sustain * parameters.release * sampleRate);
+        const int holdSamples = static_cast<int>(0.02 * sampleRate);
+
+        FreOscSound sound;
+        FreOscVoice voice;
+        voice.setCurrentPlaybackSampleRate(sampleRate);
+        voice.setParameters(parameters);
+
+        juce::AudioBuffer<float> buffer(2, blockSize);
+
+        voice.startNote(69, 1.0f, &sound, 8192);
+        for (int block = 0; block < static_cast<int>(0.1 * sampleRate) / blockSize; ++block)
+        {
+            buffer.clear();
+            voice.renderNextBlock(buffer, 0, blockSize);
+        }
+
+        voice.stopNote(0.0f, true);
+
+        // Render until the voice frees itself, noting where its output last went quiet
+        int quietSample = -1;
+        int stopSample = -1;
+
+        for (int sample = 0; sample < releaseSamples + holdSamples; sample += blockSize)
+        {
+            buffer.clear();
+            voice.renderNextBlock(buffer, 0, blockSize);
+
+            if (!voice.isVoiceActive())
+            {
+                stopSample = sample;
+                break;
+            }
+
+            if (voice.getLastPeak() >= parameters.retireThreshold)
+                quietSample = -1;
+            else if (quietSample < 0)
+                quietSample = sample;
+        }
+
+        // Retired within the hold time (plus the sub-block it was detected in),
+        // while the envelope was still releasing
+        const bool passed = quietSample >= 0 && stopSample >= 0
+                         && stopSample - quietSample <= holdSamples + blockSize
+                         && stopSample < releaseSamples;
+
+        std::printf("%s released voice retires (quiet at %d, freed at %d, release ends at %d)\n",
+                    passed ? "PASS" : "FAIL", quietSample, stopSample, releaseSamples);
+        return passed;
+    }
+}
+
+//==============================================================================
+int main()
+{
+    return testReleasedVoiceRetires() ? 0 : 1;
+}